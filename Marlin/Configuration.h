@@ -1153,6 +1153,21 @@
  */
 //#define S_CURVE_ACCELERATION
 
+/**
+ * Jerk-Limited Acceleration
+ *
+ * Ramp acceleration up and down at a constant jerk, giving each move a
+ * 7-segment velocity profile. Unlike S_CURVE_ACCELERATION the jerk limit
+ * is also applied by the planner when choosing junction speeds, so moves
+ * start and end with zero acceleration within the same distance.
+ * Suited to soft materials that need gentle motion without a very low
+ * acceleration setting.
+ */
+//#define JERK_LIMITED_ACCELERATION
+#if ENABLED(JERK_LIMITED_ACCELERATION)
+  #define ACCELERATION_JERK 5000 // (mm/s^3) Rate of change of acceleration. Set with M205 K.
+#endif
+
 //===========================================================================
 //============================= Z Probe Options =============================
 //===========================================================================
@@ -137,6 +137,35 @@
   #define REDUNDANT_BETA                   3950    // Beta value
 #endif
 
+/**
+ * Fine thermistor tables
+ * Instead of the 5 °C steps of the regular tables, convert readings with a table that
+ * is evenly spaced in ADC counts and computed at compile time from the R25, beta and
+ * pull-up of each sensor type. A reading is one table lookup and an integer
+ * interpolation, with 1/32 °C resolution. For tight windows like cell printing beds.
+ * Applies to types 1-13, 30, 51, 52, 55, 60, 61, 66, 67, 70, 71 and 2000.
+ * Other sensors keep the regular tables. Requires a 32-bit board.
+ */
+//#define THERMISTOR_FINE_TABLES
+#if ENABLED(THERMISTOR_FINE_TABLES)
+  #define THERMISTOR_FINE_TABLE_BITS 9  // 2^N + 1 entries (2 bytes each) per sensor type
+#endif
+
+/**
+ * Continuous ADC scan
+ * The ADC converts all the analog inputs over and over, by DMA, into a ring buffer
+ * instead of the temperature ISR starting one conversion per sensor. Once per control
+ * period the buffer is filtered for each sensor. Less ISR load and less noise.
+ * All the analog pins must be channels of one ADC (ADC3 for the Octopus thermistors).
+ * STM32F4 and the Linux simulator only.
+ */
+//#define ADC_CONTINUOUS_SCAN
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+  #define ADC_SCAN_SAMPLES   32                 // Readings per channel in the ring buffer (2-64)
+  #define ADC_SCAN_FILTER    ADC_FILTER_MEDIAN  // ADC_FILTER_AVERAGE, ADC_FILTER_MEDIAN or ADC_FILTER_IIR
+  #define ADC_SCAN_IIR_SHIFT 2                  // IIR: Move 1/2^N of the way to each new average
+#endif
+
 /**
  * Thermocouple Options — for MAX6675 (-2), MAX31855 (-3), and MAX31865 (-5).
  */
@@ -400,6 +429,56 @@
   #endif
 #endif
 
+#if ANY(PIDTEMP, PIDTEMPBED, PIDTEMPCHAMBER)
+  /**
+   * PID control loops
+   * Each PID loop normally runs once per ADC round (about 164ms) on the latest reading.
+   * Give a loop a longer period to run it less often on readings smoothed over the
+   * period, as slow Peltier zones prefer. Tuned Ki and Kd are rescaled for the period.
+   */
+  //#define PID_CONTROL_LOOPS
+  #if ENABLED(PID_CONTROL_LOOPS)
+    #define HOTEND_PID_PERIOD  { 0, 0 } // (ms) For each hotend. 0 to run every ADC round.
+    #define HOTEND_PID_FILTER  { 0, 0 } // 0-7. Each reading moves the loop input 1/2^N of the way.
+    #define BED_PID_PERIOD     0        // (ms) With PIDTEMPBED
+    #define BED_PID_FILTER     0
+    #define CHAMBER_PID_PERIOD 0        // (ms) With PIDTEMPCHAMBER
+    #define CHAMBER_PID_FILTER 0
+  #endif
+
+  /**
+   * Chamber feed-forward
+   * Add Ka * (target - chamber) to the output of each hotend and bed PID loop, so a
+   * change in the chamber temperature is met before it shows up as error. Ka is
+   * learned from the steady power while a zone holds its target, with separate
+   * values for targets above and below the chamber. Use M747 to view or set Ka
+   * and M500 to save it. Requires a chamber sensor.
+   */
+  //#define PID_CHAMBER_FEEDFORWARD
+  #if ENABLED(PID_CHAMBER_FEEDFORWARD)
+    #define CHAMBER_FF_SETTLE_BAND  0.5 // (°C) A zone within this error is settled
+    #define CHAMBER_FF_SETTLE_TIME   60 // (s) Settled time before learning starts
+    #define CHAMBER_FF_MIN_DELTA    2.0 // (°C) Don't learn when the target is this close to the chamber
+    #define CHAMBER_FF_LEARN_SHIFT    8 // Each PID update moves Ka 1/2^N of the way
+  #endif
+
+  /**
+   * Step response autotune
+   * 'M303 Q' applies a step of power and fits a first-order plus dead time model to
+   * the response, stopping once the fit is good. This takes a fraction of the time of
+   * the relay cycles of plain M303. A zone that gets to its target before the fit is
+   * good goes on with relay feedback around the target until two cycles agree.
+   * 'M303 Q A' tunes every PID zone that has a target, all at the same time. A Peltier
+   * zone is only driven in the direction its mode pin allows.
+   */
+  //#define PID_STEP_AUTOTUNE
+  #if ENABLED(PID_STEP_AUTOTUNE)
+    #define PID_STEP_AUTOTUNE_POWER      50 // (%) Power of the step
+    #define PID_STEP_AUTOTUNE_CONFIDENCE  5 // (%) Stop when the error in the time constant is below this
+    #define PID_STEP_AUTOTUNE_TIMEOUT    30 // (min) Give up on zones not done by then
+  #endif
+#endif
+
 /**
  * Automatic Temperature Mode
  *
@@ -481,6 +560,16 @@
   #define HOTEND_IDLE_BED_TARGET      0     // (°C) Safe temperature for the bed after timeout
 #endif
 
+/**
+ * Multi-zone wait
+ * M116 waits for the hotends, bed and heated chamber together instead of one
+ * after another. Each one uses its own window and residency time from
+ * Configuration.h, so the wait is as long as the slowest heater.
+ * 'M116 P' starts the residency timers and returns at once, so homing and
+ * probing can run while the heaters settle. A later M116 waits for the rest.
+ */
+//#define MULTI_ZONE_WAIT
+
 // @section temperature
 
 // Calibration for AD595 / AD8495 sensor to adjust temperature measurements.
@@ -1527,9 +1616,61 @@
   //#define SDCARD_READONLY                 // Read-only SD card (to save over 2K of flash)
 
   //#define GCODE_REPEAT_MARKERS            // Enable G-code M808 to set repeat markers and do looping
+  #if ENABLED(GCODE_REPEAT_MARKERS)
+    /**
+     * Keep the queued commands of an innermost M808 loop in RAM on the first pass
+     * and replay them for the other passes, with no SD seek or G-code parsing.
+     * Bodies that are too big, or that use SD commands (M20-M34), are read again.
+     */
+    #define GCODE_REPEAT_CACHE
+    #if ENABLED(GCODE_REPEAT_CACHE)
+      #define GCODE_REPEAT_CACHE_SIZE 4096  // (bytes) Largest loop body to cache, at about 20-100 bytes per command
+    #endif
+  #endif
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
+  // Read the printing file several blocks at a time into RAM, using multi-block transfers.
+  // Helps dense toolpaths keep the planner fed from SD at high segment rates.
+  #define SD_READ_AHEAD
+  #if ENABLED(SD_READ_AHEAD)
+    #define SD_READ_AHEAD_BLOCKS 8          // (512 byte blocks) Size of the read-ahead buffer
+  #endif
+
+  /**
+   * Print heatshrink compressed G-code (*.hs, e.g., 'part.gcode.hs'), decoding while printing.
+   * Compress with 'heatshrink -e -w 8 -l 4 part.gcode part.gcode.hs'.
+   * Seeking backward (M26, M808, power-loss resume) decodes again from the start of the file.
+   */
+  #define SD_HEATSHRINK
+
+  /**
+   * Line and layer index for the selected file, to seek by line or layer
+   * without computing byte positions on the host.
+   *  M730 - Build or load the index. It is saved in the root folder as a sidecar file.
+   *  M731 - Seek to a line (L) or layer (P), then M24 to resume.
+   */
+  //#define SD_LINE_INDEX
+  #if ENABLED(SD_LINE_INDEX)
+    #define SD_INDEX_SIZE 1024                // Entries each for lines and layers (4 bytes each)
+    #define SD_INDEX_LAYER_MARKER ";LAYER:"   // Comment that starts each layer. e.g., ";LAYER_CHANGE" for PrusaSlicer
+  #endif
+
+  /**
+   * Binary telemetry log on the SD card, for print records. Temperatures and position
+   * are sampled at a fixed interval, plus pneumatic valve events and host notes.
+   * Records are buffered in RAM and written a whole block at a time.
+   *  M743 <file> - Start logging, appending to the file. Report the state without a file name.
+   *  M744        - Stop logging and close the file.
+   *  M745 C<code> V<value> - Add a note, e.g., a pressure reading from the host.
+   * Read logs with buildroot/share/scripts/sd_log_dump.py
+   */
+  //#define SD_LOG
+  #if ENABLED(SD_LOG)
+    #define SD_LOG_INTERVAL    100  // (ms) Time between samples
+    #define SD_LOG_SYNC_BLOCKS  16  // Blocks written between file size updates in the directory
+  #endif
+
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
   #define SD_FINISHED_RELEASECOMMAND "M84"  // Use "M84XYE" to keep Z enabled so your bed stays in place
 
@@ -2105,8 +2246,21 @@
 #if ENABLED(LIN_ADVANCE)
   //#define EXTRA_LIN_ADVANCE_K // Enable for second linear advance constants
   #define LIN_ADVANCE_K 0.22    // Unit: mm compression per 1mm/s extruder speed
+  //#define LIN_ADVANCE_K_LIST { 0.22, 0.0 } // Per-extruder K values, overriding LIN_ADVANCE_K. (BIOPRINTER: E1 is pneumatic, K=0)
+
+  /**
+   * Nonlinear (pressure-dependent) advance for compliant media such as syringe-fed bioinks.
+   * Adds a quadratic term so that: advance [mm] = K * v + K2 * v^2  (v = extruder speed in mm/s)
+   * Set per extruder with M900 T<tool> Q<K2>.
+   */
+  //#define LIN_ADVANCE_NONLINEAR
+  #if ENABLED(LIN_ADVANCE_NONLINEAR)
+    #define LIN_ADVANCE_K2 0.0  // Unit: mm compression per (1mm/s extruder speed)^2
+  #endif
+
+  //#define LIN_ADVANCE_CALIBRATION // Add M901 to print a K-factor calibration pattern
   //#define LA_DEBUG            // If enabled, this will generate debug information output over USB.
-  //#define EXPERIMENTAL_SCURVE // Enable this option to permit S-Curve Acceleration
+  //#define EXPERIMENTAL_SCURVE // Enable this option to permit S-Curve or Jerk-Limited Acceleration
   //#define ALLOW_LOW_EJERK     // Allow a DEFAULT_EJERK value of <10. Recommended for direct drive hotends.
 #endif
 
@@ -2278,6 +2432,7 @@
   #define MAX_ARC_SEGMENT_MM      1.0 // (mm) Maximum length of each arc segment
   #define MIN_CIRCLE_SEGMENTS    72   // Minimum number of segments in a complete circle
   //#define ARC_SEGMENTS_PER_SEC 50   // Use the feedrate to choose the segment length
+  //#define ARC_MAX_CHORDAL_ERROR 0.005 // (mm) Use the radius to choose the segment length. Overrides MIN_CIRCLE_SEGMENTS.
   #define N_ARC_CORRECTION       25   // Number of interpolated segments between corrections
   //#define ARC_P_CIRCLES             // Enable the 'P' parameter to specify complete circles
   //#define SF_ARC_FIX                // Enable only if using SkeinForge with "Arc Point" fillet procedure
@@ -2299,6 +2454,11 @@
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
  */
 //#define DIRECT_STEPPING
+#if ENABLED(DIRECT_STEPPING)
+  // Also accept run-length compressed pages ('$' frames), expanded into the page buffer
+  // as they arrive. Encode them with buildroot/share/scripts/direct_stepping_pack.py
+  //#define DIRECT_STEPPING_RLE
+#endif
 
 /**
  * G38 Probe Target
@@ -2359,6 +2519,20 @@
  */
 //#define MAXIMUM_STEPPER_RATE 250000
 
+/**
+ * ISR Cycle Statistics
+ * Measure the cycles spent in the Stepper, block phase and Temperature ISRs at runtime.
+ * Uses the DWT cycle counter on STM32 (Cortex-M3/M4/M7) and a high resolution clock on LINUX.
+ * Use M720 to report min/avg/max cycles, M720 R to reset, M720 S1 to apply measured step limits.
+ * Stepper ISR figures include time spent in ISRs that preempt it, such as serial and USB.
+ */
+//#define ISR_CYCLE_STATS
+#if ENABLED(ISR_CYCLE_STATS)
+  //#define ISR_CYCLE_STATS_AUTO_LIMITS   // Apply measured multistepping limits automatically
+  #define ISR_CYCLE_STATS_MARGIN     25   // (%) Headroom added to measured cycles when deriving step limits
+  #define ISR_CYCLE_STATS_MIN_SAMPLES 10000 // Stepper ISR samples required before deriving step limits
+#endif
+
 // @section temperature
 
 // Control heater 0 and heater 1 in parallel.
@@ -2462,6 +2636,21 @@
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 //#define ADVANCED_OK
 
+/**
+ * Windowed serial flow control
+ * Lets a host keep several numbered lines in flight instead of waiting
+ * for each "ok". After 'M735 S1' on a port every "ok" is sent as
+ * "ok N<line> C<credits>" and the host may send up to line N+C before
+ * the next "ok". After a "Resend:" the lines already in flight are
+ * dropped silently until the requested line arrives, so there is only
+ * one resend per window. Advertised in M115 as "Cap:FLOW_WINDOW".
+ */
+//#define SERIAL_FLOW_WINDOW
+#if ENABLED(SERIAL_FLOW_WINDOW)
+  #define SERIAL_FLOW_WINDOW_RX_LINES 4 // Lines the RX buffer may hold beyond the command queue.
+                                        // For UART ports allow RX_BUFFER_SIZE for this many full lines.
+#endif
+
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
 #define SERIAL_OVERRUN_PROTECTION
@@ -2550,6 +2739,25 @@
    */
   //#define TOOL_SENSOR
 
+  /**
+   * Tool-change pre-conditioning
+   * Look in the command queue and the SD read-ahead for a tool-change followed
+   * by the new tool's M104/M109 and set that temperature early, to cut the wait
+   * at the change. Requires SD_READ_AHEAD to look further than the command queue.
+   *
+   * The look-ahead is only the unread part of the read-ahead buffer, at most
+   * SD_READ_AHEAD_BLOCKS * 512 bytes of G-code, which usually takes seconds to
+   * print. That is far less than the lead time a hotend needs (the change at the
+   * given rate plus the margin), so the target is nearly always set as soon as
+   * the tool-change is seen and the tool will usually still need some time at
+   * the change. The lead time only holds it back for very slow G-code.
+   */
+  //#define TOOLCHANGE_PRECONDITION
+  #if ENABLED(TOOLCHANGE_PRECONDITION)
+    #define TOOLCHANGE_PRECONDITION_RATES  { 0.5, 0.5 } // (°C/s) Heating or cooling rate of each hotend
+    #define TOOLCHANGE_PRECONDITION_MARGIN 10           // (s) Extra lead time
+  #endif
+
   /**
    * Retract and prime filament on tool-change to reduce
    * ooze and stringing and to get cleaner transitions.
@@ -2611,6 +2819,24 @@
   #endif
 #endif // HAS_MULTI_EXTRUDER
 
+/**
+ * Syringe Volume
+ * Track the volume left in each syringe from the extruder travel and refill
+ * before it runs out. Below the margin the next extruding move at a new
+ * layer raises Z, homes E0 to its refill position (G28 E) and waits for the
+ * operator to swap or fill the syringe. An empty syringe stops right away.
+ *
+ * Requires an LCD display, HOST_PROMPT_SUPPORT, or EMERGENCY_PARSER to continue.
+ * Use M921 to set the syringe sizes and M500 to save them.
+ */
+//#define SYRINGE_VOLUME
+#if ENABLED(SYRINGE_VOLUME)
+  #define SYRINGE_DIAMETER      { 14.5, 14.5 }  // (mm) Bore of each syringe
+  #define SYRINGE_CAPACITY      { 3000, 0 }     // (µL) Full volume of each syringe. 0 to not track.
+  #define SYRINGE_REFILL_MARGIN 100             // (µL) Refill at the next layer below this volume
+  #define SYRINGE_REFILL_Z_RAISE 10             // (mm) Raise Z for the refill
+#endif
+
 /**
  * Advanced Pause for Filament Change
  *  - Adds the G-code M600 Filament Change to initiate a filament change.
@@ -3206,6 +3432,28 @@
     #define STOP_ON_ERROR
   #endif
 
+  /**
+   * Syringe load monitor
+   * Sample the StallGuard result (SG_RESULT) of the E0 driver while it moves and
+   * compare it to a rolling baseline, learned again whenever the speed changes.
+   * SG_RESULT falls as the load rises, so a drop means a clogged needle and a rise
+   * means air in the syringe or an empty barrel. Either one, lasting long enough,
+   * pauses the print through the host and runs SYRINGE_MONITOR_SCRIPT.
+   * M920 to turn it on or off, set the limits and stream the samples.
+   * Each sample reads up to three registers over UART, so don't sample too often.
+   * TMC2209 E0 in StealthChop only.
+   */
+  //#define SYRINGE_MONITOR
+  #if ENABLED(SYRINGE_MONITOR)
+    #define SYRINGE_MONITOR_INTERVAL_MS 200 // (ms) Time between samples
+    #define SYRINGE_MONITOR_CLOG         30 // (%) Drop below the baseline for a clog
+    #define SYRINGE_MONITOR_EMPTY        40 // (%) Rise above the baseline for air or an empty syringe
+    #define SYRINGE_MONITOR_TRIP_MS    2000 // (ms) How long a drop or rise must last
+    #define SYRINGE_MONITOR_LEARN        10 // Samples at a new speed to learn the baseline
+    #define SYRINGE_MONITOR_SHIFT         5 // The baseline then follows 1/2^N of each good sample
+    //#define SYRINGE_MONITOR_SCRIPT "M25"  // Also run this on a trip, e.g., to pause a print from SD
+  #endif
+
   /**
    * TMC2130, TMC2160, TMC2208, TMC2209, TMC5130 and TMC5160 only
    * The driver will switch to spreadCycle when stepper speed is over HYBRID_THRESHOLD.
@@ -3971,6 +4219,19 @@
   //#define AUTO_REPORT_REDUNDANT // Include the "R" sensor in the auto-report
 #endif
 
+/**
+ * Temperature history
+ * Keep the temperatures and heater powers of all sensors in a RAM ring buffer,
+ * one sample per interval holding the mean, lowest and highest readings.
+ * M746 sends the buffer to the host as a binary frame and the touch UI can
+ * plot it. Each sample uses 4 + 7 bytes per sensor.
+ */
+//#define TEMP_HISTORY
+#if ENABLED(TEMP_HISTORY)
+  #define TEMP_HISTORY_INTERVAL  60   // (s) Time covered by each sample
+  #define TEMP_HISTORY_SAMPLES  180   // Samples kept, e.g., 3 hours at one per minute
+#endif
+
 /**
  * Auto-report position with M154 S<seconds>
  */
@@ -4042,12 +4303,23 @@
 
 #if ENABLED(FASTER_GCODE_PARSER)
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
+  //#define GCODE_PREPARSE        // Parse commands as they are queued and keep the values as floats in the queue
 #endif
 
 // Support for MeatPack G-code compression (https://github.com/scottmudge/OctoPrint-MeatPack)
 //#define MEATPACK_ON_SERIAL_PORT_1
 //#define MEATPACK_ON_SERIAL_PORT_2
 
+/**
+ * Packed G-code frames
+ * Hosts may send binary frames in place of text lines. Each has the command
+ * code, fixed-point parameters (optionally as deltas from the previous value)
+ * and a CRC16, and is decoded straight into the parser with no text parsing.
+ * Encode G-code with buildroot/share/scripts/packed_gcode.py.
+ * Advertised in M115 as "Cap:PACKED_GCODE".
+ */
+//#define PACKED_GCODE
+
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
 //#define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
@@ -4276,6 +4548,18 @@
   #define CANCEL_OBJECTS_REPORTING // Emit the current object as a status message
 #endif
 
+/**
+ * Well plate arrays
+ * Print the selected SD file once in each well of a plate, shifting the
+ * workspace to the center of each well in turn. Set the plate with M740,
+ * correct single wells with M742 and start with M741.
+ * With CANCEL_OBJECTS each well is an object that M486 can cancel.
+ */
+//#define WELL_PLATE_ARRAY
+#if ENABLED(WELL_PLATE_ARRAY)
+  #define WELL_PLATE_MAX_WELLS 96   // Most wells on a plate, up to 127. 12 bytes each for corrections.
+#endif
+
 /**
  * I2C position encoders for closed loop control.
  * Developed by Chris Barr at Aus3D.
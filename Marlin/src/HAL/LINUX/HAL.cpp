@@ -24,6 +24,12 @@
 #include "../../inc/MarlinConfig.h"
 #include "../shared/Delay.h"
 
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+  #include "../shared/adc_scan.h"
+#endif
+
+#include <chrono>
+
 // ------------------------
 // Serial ports
 // ------------------------
@@ -56,6 +62,20 @@ uint16_t MarlinHAL::adc_value() {
   return data;    // return 10bit value as Marlin expects
 }
 
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+  // The simulation thread fills the buffer with an ADCScanner
+  void ADCScan::start() {}
+#endif
+
 void MarlinHAL::reboot() { /* Reset the application state and GPIO */ }
 
+// ------------------------
+// Cycle counter
+// ------------------------
+
+uint32_t MarlinHAL::cycle_count() {
+  const uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  return uint32_t(ns * ((F_CPU) / 1000000UL) / 1000UL);
+}
+
 #endif // __PLAT_LINUX__
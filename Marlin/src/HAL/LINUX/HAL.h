@@ -158,4 +158,10 @@ public:
   }
 
   static void set_pwm_frequency(const pin_t, int) {}
+
+  //
+  // Cycle counter, emulated at F_CPU from a high resolution clock
+  //
+  #define HAL_CYCLE_COUNTER
+  static uint32_t cycle_count();
 };
@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+
+#include "Clock.h"
+#include "ADCScanner.h"
+#include "../../shared/adc_scan.h"
+
+// Time to convert one channel, about what the STM32 takes with the
+// longest sample time
+#define ADC_CONVERSION_US 44
+
+uint8_t ADCScanner::row; // = 0
+
+ADCScanner::ADCScanner() {
+  last = Clock::micros();
+}
+
+// A whole row is written at once
+uint16_t ADCScan::write_pos() { return ADCScanner::row * ADC_SCAN_COUNT; }
+
+void ADCScanner::update() {
+  // Convert each channel of the row, 10 bits as MarlinHAL::adc_value() reads
+  auto now = Clock::micros();
+  if (now - last < ADC_CONVERSION_US * ADC_SCAN_COUNT) return;
+  last = now;
+  LOOP_L_N(i, ADC_SCAN_COUNT) {
+    const pin_t pin = analogInputToDigitalPin(ADCScan::pins[i]);
+    adc_scan.buffer[row][i] = VALID_PIN(pin) ? (Gpio::get(pin) >> 2) & 0x3FF : 0;
+  }
+  if (++row >= ADC_SCAN_SAMPLES) row = 0;
+}
+
+#endif // ADC_CONTINUOUS_SCAN
+#endif // __PLAT_LINUX__
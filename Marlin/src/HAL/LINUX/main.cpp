@@ -29,9 +29,16 @@
 #include "hardware/IOLoggerCSV.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
+#include "hardware/ADCScanner.h"
+
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+  #include "../../gcode/queue.h"
+  #include "../../feature/print_time_estimator.h"
+#endif
 
 #include <stdio.h>
 #include <stdarg.h>
+#include <unistd.h>
 #include <thread>
 #include <iostream>
 #include <fstream>
@@ -53,9 +60,19 @@ void read_serial_thread() {
   char buffer[255] = {};
   for (;;) {
     std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
-      for (std::size_t i = 0; i < strlen(buffer); i++)
+    // Raw reads so binary input (e.g., packed G-code) gets through
+    const ssize_t count = len ? read(STDIN_FILENO, buffer, len) : -1;
+    if (count > 0)
+      for (ssize_t i = 0; i < count; i++)
         usb_serial.receive_buffer.write(buffer[i]);
+    #if ENABLED(PRINT_TIME_ESTIMATOR)
+      else if (count == 0) {
+        // End the last line, in case the file has no newline at the end
+        usb_serial.receive_buffer.write('\n');
+        estimator.input_done = true;
+        return;
+      }
+    #endif
     std::this_thread::yield();
   }
 }
@@ -67,6 +84,9 @@ void simulation_loop() {
   LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
   LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
   LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+  #if ENABLED(ADC_CONTINUOUS_SCAN)
+    ADCScanner adc_scanner;
+  #endif
 
   #ifdef GPIO_LOGGING
     IOLoggerCSV logger("all_gpio_log.csv");
@@ -82,6 +102,7 @@ void simulation_loop() {
 
     hotend.update();
     bed.update();
+    TERN_(ADC_CONTINUOUS_SCAN, adc_scanner.update());
 
     x_axis.update();
     y_axis.update();
@@ -127,6 +148,15 @@ int main() {
   setup();
   for (;;) {
     loop();
+    #if ENABLED(PRINT_TIME_ESTIMATOR)
+      // Report and exit once all G-code from stdin has been run
+      if (estimator.input_done && !usb_serial.receive_buffer.available() && !queue.has_commands_queued()) {
+        estimator.finish();
+        while (usb_serial.transmit_buffer.available()) std::this_thread::yield();
+        fflush(stdout);
+        exit(0);
+      }
+    #endif
     std::this_thread::yield();
   }
 
@@ -49,6 +49,12 @@
   #include "usbd_cdc_if.h"
 #endif
 
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+  #include "../shared/adc_scan.h"
+  #include <PeripheralPins.h>
+  #include <pinmap.h>
+#endif
+
 // ------------------------
 // Public Variables
 // ------------------------
@@ -89,7 +95,7 @@ void MarlinHAL::init() {
 
   SetTimerInterruptPriorities();
 
-  #if ENABLED(EMERGENCY_PARSER) && (USBD_USE_CDC || USBD_USE_CDC_MSC)
+  #if EITHER(EMERGENCY_PARSER, DIRECT_STEPPING) && (USBD_USE_CDC || USBD_USE_CDC_MSC)
     USB_Hook_init();
   #endif
 
@@ -141,6 +147,126 @@ uint8_t MarlinHAL::get_reset_source() {
 
 void MarlinHAL::clear_reset_source() { __HAL_RCC_CLEAR_RESET_FLAGS(); }
 
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+
+  //
+  // ADC scan by DMA
+  //
+  // The ADC converts the whole sequence over and over and the DMA stream
+  // writes it into the ring buffer, with no interrupts. All the scanned
+  // pins must be channels of one ADC.
+  //
+
+  static ADC_HandleTypeDef hadc_scan;
+  static DMA_HandleTypeDef hdma_scan;
+
+  // Channel number of a pin on the given ADC, or -1
+  static int8_t adc_channel(ADC_TypeDef * const adc, const pin_t pin, uint32_t &function) {
+    const PinName pn = digitalPinToPinName(pin);
+    for (const PinMap *m = PinMap_ADC; m->pin != NC; ++m)
+      if (PinName(m->pin & ~ALTX_MASK) == pn && m->peripheral == adc) {
+        function = m->function;
+        return STM_PIN_CHANNEL(m->function);
+      }
+    return -1;
+  }
+
+  // The first ADC with all the pins as channels
+  static ADC_TypeDef* scan_adc() {
+    ADC_TypeDef * const adcs[] = {
+      ADC1
+      #ifdef ADC2
+        , ADC2
+      #endif
+      #ifdef ADC3
+        , ADC3
+      #endif
+    };
+    for (ADC_TypeDef * const adc : adcs) {
+      bool all = true;
+      uint32_t f;
+      LOOP_L_N(i, ADC_SCAN_COUNT) if (adc_channel(adc, ADCScan::pins[i], f) < 0) { all = false; break; }
+      if (all) return adc;
+    }
+    return nullptr;
+  }
+
+  void ADCScan::start() {
+    ADC_TypeDef * const adc = scan_adc();
+    if (!adc) {
+      // Leave the buffer at zero so the sensors report an error
+      SERIAL_ERROR_MSG("ADC_CONTINUOUS_SCAN pins must all be on one ADC.");
+      return;
+    }
+
+    // DMA2 stream and channel for each ADC (RM0390 Table 29)
+    __HAL_RCC_DMA2_CLK_ENABLE();
+    if (adc == ADC1) { hdma_scan.Instance = DMA2_Stream0; hdma_scan.Init.Channel = DMA_CHANNEL_0; }
+    #ifdef ADC2
+      else if (adc == ADC2) { hdma_scan.Instance = DMA2_Stream2; hdma_scan.Init.Channel = DMA_CHANNEL_1; }
+    #endif
+    #ifdef ADC3
+      else if (adc == ADC3) { hdma_scan.Instance = DMA2_Stream1; hdma_scan.Init.Channel = DMA_CHANNEL_2; }
+    #endif
+    hdma_scan.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    hdma_scan.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_scan.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_scan.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    hdma_scan.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+    hdma_scan.Init.Mode = DMA_CIRCULAR;
+    hdma_scan.Init.Priority = DMA_PRIORITY_LOW;
+    hdma_scan.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    HAL_DMA_Init(&hdma_scan);
+
+    // HAL_ADC_MspInit (in the core) enables the ADC clock
+    #define _ADC_RES(N) ADC_RESOLUTION_##N##B
+    #define ADC_RES(N) _ADC_RES(N)
+    hadc_scan.Instance = adc;
+    hadc_scan.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV8;
+    hadc_scan.Init.Resolution = ADC_RES(HAL_ADC_RESOLUTION);
+    hadc_scan.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+    hadc_scan.Init.ScanConvMode = ENABLE;
+    hadc_scan.Init.EOCSelection = ADC_EOC_SEQ_CONV;
+    hadc_scan.Init.ContinuousConvMode = ENABLE;
+    hadc_scan.Init.NbrOfConversion = ADC_SCAN_COUNT;
+    hadc_scan.Init.DiscontinuousConvMode = DISABLE;
+    hadc_scan.Init.NbrOfDiscConversion = 0;
+    hadc_scan.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+    hadc_scan.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
+    hadc_scan.Init.DMAContinuousRequests = ENABLE;
+    HAL_ADC_Init(&hadc_scan);
+    __HAL_LINKDMA(&hadc_scan, DMA_Handle, hdma_scan);
+
+    // The longest sample time suits the high impedance of thermistor dividers
+    ADC_ChannelConfTypeDef config = {0};
+    config.SamplingTime = ADC_SAMPLETIME_480CYCLES;
+    LOOP_L_N(i, ADC_SCAN_COUNT) {
+      uint32_t function;
+      config.Channel = adc_channel(adc, pins[i], function);
+      config.Rank = i + 1;
+      pin_function(digitalPinToPinName(pins[i]), function); // Analog mode
+      HAL_ADC_ConfigChannel(&hadc_scan, &config);
+    }
+
+    // The DMA interrupts are left disabled in the NVIC
+    HAL_ADC_Start_DMA(&hadc_scan, (uint32_t *)buffer, ADC_SCAN_SAMPLES * ADC_SCAN_COUNT);
+  }
+
+  // The DMA counts down the entries left to the end of the buffer
+  uint16_t ADCScan::write_pos() {
+    constexpr uint16_t size = ADC_SCAN_SAMPLES * ADC_SCAN_COUNT;
+    return hdma_scan.Instance ? (size - __HAL_DMA_GET_COUNTER(&hdma_scan)) % size : 0;
+  }
+
+  void MarlinHAL::adc_init() { ADCScan::start(); }
+
+  void MarlinHAL::adc_start(const pin_t pin) {
+    const int8_t i = ADCScan::index(pin);
+    adc_result = i < 0 ? 0 : ADCScan::reading(i);
+  }
+
+#endif // ADC_CONTINUOUS_SCAN
+
 extern "C" {
   extern unsigned int _ebss; // end of bss section
 }
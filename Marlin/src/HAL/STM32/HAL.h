@@ -235,16 +235,31 @@ public:
 
   static uint16_t adc_result;
 
-  // Called by Temperature::init once at startup
-  static void adc_init() {
-    analogReadResolution(HAL_ADC_RESOLUTION);
-  }
+  #if ENABLED(ADC_CONTINUOUS_SCAN)
 
-  // Called by Temperature::init for each sensor at startup
-  static void adc_enable(const pin_t pin) { pinMode(pin, INPUT); }
+    // Start the DMA scan of all analog inputs
+    static void adc_init();
 
-  // Begin ADC sampling on the given pin. Called from Temperature::isr!
-  static void adc_start(const pin_t pin) { adc_result = analogRead(pin); }
+    // Pins are set up by adc_init
+    static void adc_enable(const pin_t) {}
+
+    // Take the latest reading of the pin from the scan buffer
+    static void adc_start(const pin_t pin);
+
+  #else
+
+    // Called by Temperature::init once at startup
+    static void adc_init() {
+      analogReadResolution(HAL_ADC_RESOLUTION);
+    }
+
+    // Called by Temperature::init for each sensor at startup
+    static void adc_enable(const pin_t pin) { pinMode(pin, INPUT); }
+
+    // Begin ADC sampling on the given pin. Called from Temperature::isr!
+    static void adc_start(const pin_t pin) { adc_result = analogRead(pin); }
+
+  #endif
 
   // Is the ADC ready for reading?
   static bool adc_ready() { return true; }
@@ -265,4 +280,12 @@ public:
    */
   static void set_pwm_frequency(const pin_t pin, const uint16_t f_desired);
 
+  //
+  // Cycle counter (Cortex-M3/M4/M7 DWT), enabled by calibrate_delay_loop()
+  //
+  #ifdef DWT_CTRL_CYCCNTENA_Msk
+    #define HAL_CYCLE_COUNTER
+    static uint32_t cycle_count() { return DWT->CYCCNT; }
+  #endif
+
 };
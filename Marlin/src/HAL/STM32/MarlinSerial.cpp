@@ -31,6 +31,10 @@
   #include "../../feature/e_parser.h"
 #endif
 
+#if ENABLED(DIRECT_STEPPING)
+  #include "../../feature/direct_stepping.h"
+#endif
+
 #ifndef USART4
   #define USART4 UART4
 #endif
@@ -80,7 +84,9 @@
 void MarlinSerial::begin(unsigned long baud, uint8_t config) {
   HardwareSerial::begin(baud, config);
   // Replace the IRQ callback with the one we have defined
-  TERN_(EMERGENCY_PARSER, _serial.rx_callback = _rx_callback);
+  #if EITHER(EMERGENCY_PARSER, DIRECT_STEPPING)
+    _serial.rx_callback = _rx_callback;
+  #endif
 }
 
 // This function is Copyright (c) 2006 Nicholas Zambetti.
@@ -90,6 +96,10 @@ void MarlinSerial::_rx_complete_irq(serial_t *obj) {
 
   if (uart_getc(obj, &c) == 0) {
 
+    #if ENABLED(DIRECT_STEPPING)
+      if (page_manager.maybe_store_rxd_char(c)) return;
+    #endif
+
     rx_buffer_index_t i = (unsigned int)(obj->rx_head + 1) % SERIAL_RX_BUFFER_SIZE;
 
     // if we should be storing the received character into the location
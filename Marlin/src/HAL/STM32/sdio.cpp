@@ -314,16 +314,17 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
   }
 
   /**
-   * @brief Read or Write a block
-   * @details Read or Write a block with SDIO
+   * @brief Read or Write blocks
+   * @details Read or Write one or more consecutive blocks with SDIO
    *
-   * @param block The block index
+   * @param block The first block index
    * @param src The data buffer source for a write
    * @param dst The data buffer destination for a read
+   * @param count The number of blocks
    *
    * @return true on success
    */
-  static bool SDIO_ReadWriteBlock_DMA(uint32_t block, const uint8_t *src, uint8_t *dst) {
+  static bool SDIO_ReadWriteBlock_DMA(uint32_t block, const uint8_t *src, uint8_t *dst, const uint16_t count=1) {
     if (HAL_SD_GetCardState(&hsd) != HAL_SD_CARD_TRANSFER) return false;
 
     HAL_watchdog_refresh();
@@ -332,12 +333,12 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
     if (src) {
       hdma_sdio.Init.Direction = DMA_MEMORY_TO_PERIPH;
       HAL_DMA_Init(&hdma_sdio);
-      ret = HAL_SD_WriteBlocks_DMA(&hsd, (uint8_t*)src, block, 1);
+      ret = HAL_SD_WriteBlocks_DMA(&hsd, (uint8_t*)src, block, count);
     }
     else {
       hdma_sdio.Init.Direction = DMA_PERIPH_TO_MEMORY;
       HAL_DMA_Init(&hdma_sdio);
-      ret = HAL_SD_ReadBlocks_DMA(&hsd, (uint8_t*)dst, block, 1);
+      ret = HAL_SD_ReadBlocks_DMA(&hsd, (uint8_t*)dst, block, count);
     }
 
     if (ret != HAL_OK) {
@@ -346,7 +347,7 @@ void HAL_SD_MspInit(SD_HandleTypeDef *hsd) {
       return false;
     }
 
-    millis_t timeout = millis() + SD_TIMEOUT;
+    millis_t timeout = millis() + SD_TIMEOUT * count;
     // Wait the transfer
     while (hsd.State != HAL_SD_STATE_READY) {
       if (ELAPSED(millis(), timeout)) {
@@ -406,6 +407,43 @@ bool SDIO_ReadBlock(uint32_t block, uint8_t *dst) {
   #endif
 }
 
+/**
+ * @brief Read consecutive blocks
+ * @details Read several blocks from media with one SDIO multi-block transfer
+ *
+ * @param block The first block index
+ * @param dst The block buffer, word aligned
+ * @param count The number of blocks
+ *
+ * @return true on success
+ */
+bool SDIO_ReadBlocks(uint32_t block, uint8_t *dst, const uint16_t count) {
+  #ifdef SDIO_FOR_STM32H7
+
+    uint32_t timeout = HAL_GetTick() + SD_TIMEOUT;
+
+    while (HAL_SD_GetCardState(&hsd) != HAL_SD_CARD_TRANSFER)
+      if (HAL_GetTick() >= timeout) return false;
+
+    waitingRxCplt = 1;
+    if (HAL_SD_ReadBlocks_DMA(&hsd, (uint8_t*)dst, block, count) != HAL_OK)
+      return false;
+
+    timeout = HAL_GetTick() + SD_TIMEOUT * count;
+    while (waitingRxCplt)
+      if (HAL_GetTick() >= timeout) return false;
+
+    return true;
+
+  #else
+
+    uint8_t retries = SDIO_READ_RETRIES;
+    while (retries--) if (SDIO_ReadWriteBlock_DMA(block, nullptr, dst, count)) return true;
+    return false;
+
+  #endif
+}
+
 /**
  * @brief Write a block
  * @details Write a block to media with SDIO
@@ -26,18 +26,36 @@
 
 #include "../../inc/MarlinConfigPre.h"
 
-#if ENABLED(EMERGENCY_PARSER) && (USBD_USE_CDC || USBD_USE_CDC_MSC)
+#if EITHER(EMERGENCY_PARSER, DIRECT_STEPPING) && (USBD_USE_CDC || USBD_USE_CDC_MSC)
 
 #include "usb_serial.h"
-#include "../../feature/e_parser.h"
 
-EmergencyParser::State emergency_state = EmergencyParser::State::EP_RESET;
+#if ENABLED(EMERGENCY_PARSER)
+  #include "../../feature/e_parser.h"
+  EmergencyParser::State emergency_state = EmergencyParser::State::EP_RESET;
+#endif
+
+#if ENABLED(DIRECT_STEPPING)
+  #include "../../feature/direct_stepping.h"
+#endif
 
 int8_t (*USBD_CDC_Receive_original) (uint8_t *Buf, uint32_t *Len) = nullptr;
 
 static int8_t USBD_CDC_Receive_hook(uint8_t *Buf, uint32_t *Len) {
-  for (uint32_t i = 0; i < *Len; i++)
-    emergency_parser.update(emergency_state, Buf[i]);
+  #if ENABLED(DIRECT_STEPPING)
+    // Take out page bytes, leaving the rest of the packet for the receive queue
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < *Len; i++) {
+      const uint8_t c = Buf[i];
+      if (page_manager.maybe_store_rxd_char(c)) continue;
+      TERN_(EMERGENCY_PARSER, emergency_parser.update(emergency_state, c));
+      Buf[n++] = c;
+    }
+    *Len = n;
+  #else
+    for (uint32_t i = 0; i < *Len; i++)
+      emergency_parser.update(emergency_state, Buf[i]);
+  #endif
   return USBD_CDC_Receive_original(Buf, Len);
 }
 
@@ -56,5 +74,5 @@ void USB_Hook_init() {
   USBD_CDC_fops.Receive = USBD_CDC_Receive_hook;
 }
 
-#endif // EMERGENCY_PARSER && USBD_USE_CDC
+#endif // (EMERGENCY_PARSER || DIRECT_STEPPING) && USBD_USE_CDC
 #endif // HAL_STM32
@@ -141,6 +141,12 @@ bool SDIO_ReadBlock(uint32_t blockAddress, uint8_t *data) {
   return false;
 }
 
+bool SDIO_ReadBlocks(uint32_t blockAddress, uint8_t *data, const uint16_t count) {
+  for (uint16_t i = 0; i < count; ++i, data += 512)
+    if (!SDIO_ReadBlock(blockAddress + i, data)) return false;
+  return true;
+}
+
 uint32_t millis();
 
 bool SDIO_WriteBlock(uint32_t blockAddress, const uint8_t *data) {
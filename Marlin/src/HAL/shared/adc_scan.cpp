@@ -0,0 +1,105 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+
+#include "adc_scan.h"
+#include "../../module/thermistor/thermistors.h"
+
+ADCScan adc_scan;
+
+volatile uint16_t ADCScan::buffer[ADC_SCAN_SAMPLES][ADC_SCAN_COUNT];
+raw_adc_t ADCScan::filtered[ADC_SCAN_COUNT];
+#if ADC_SCAN_FILTER == ADC_FILTER_IIR
+  uint32_t ADCScan::iir_acc[ADC_SCAN_COUNT];
+#endif
+
+const pin_t ADCScan::pins[ADC_SCAN_COUNT] = {
+  OPTITEM(HAS_TEMP_ADC_0,         TEMP_0_PIN)
+  OPTITEM(HAS_TEMP_ADC_1,         TEMP_1_PIN)
+  OPTITEM(HAS_TEMP_ADC_2,         TEMP_2_PIN)
+  OPTITEM(HAS_TEMP_ADC_3,         TEMP_3_PIN)
+  OPTITEM(HAS_TEMP_ADC_4,         TEMP_4_PIN)
+  OPTITEM(HAS_TEMP_ADC_5,         TEMP_5_PIN)
+  OPTITEM(HAS_TEMP_ADC_6,         TEMP_6_PIN)
+  OPTITEM(HAS_TEMP_ADC_7,         TEMP_7_PIN)
+  OPTITEM(HAS_TEMP_ADC_BED,       TEMP_BED_PIN)
+  OPTITEM(HAS_TEMP_ADC_CHAMBER,   TEMP_CHAMBER_PIN)
+  OPTITEM(HAS_TEMP_ADC_PROBE,     TEMP_PROBE_PIN)
+  OPTITEM(HAS_TEMP_ADC_COOLER,    TEMP_COOLER_PIN)
+  OPTITEM(HAS_TEMP_ADC_BOARD,     TEMP_BOARD_PIN)
+  OPTITEM(HAS_TEMP_ADC_REDUNDANT, TEMP_REDUNDANT_PIN)
+  OPTITEM(FILAMENT_WIDTH_SENSOR,  FILWIDTH_PIN)
+  OPTITEM(HAS_ADC_BUTTONS,        ADC_KEYPAD_PIN)
+  OPTITEM(HAS_JOY_ADC_X,          JOY_X_PIN)
+  OPTITEM(HAS_JOY_ADC_Y,          JOY_Y_PIN)
+  OPTITEM(HAS_JOY_ADC_Z,          JOY_Z_PIN)
+  OPTITEM(POWER_MONITOR_CURRENT,  POWER_MONITOR_CURRENT_PIN)
+  OPTITEM(POWER_MONITOR_VOLTAGE,  POWER_MONITOR_VOLTAGE_PIN)
+};
+
+int8_t ADCScan::index(const pin_t pin) {
+  for (uint8_t i = 0; i < ADC_SCAN_COUNT; ++i) if (pins[i] == pin) return i;
+  return -1;
+}
+
+void ADCScan::filter() {
+  for (uint8_t i = 0; i < ADC_SCAN_COUNT; ++i) {
+
+    #if ADC_SCAN_FILTER == ADC_FILTER_MEDIAN
+
+      // Insertion sort the column, then take the middle
+      uint16_t s[ADC_SCAN_SAMPLES];
+      for (uint8_t n = 0; n < ADC_SCAN_SAMPLES; ++n) {
+        const uint16_t v = buffer[n][i];
+        uint8_t j = n;
+        for (; j && s[j - 1] > v; --j) s[j] = s[j - 1];
+        s[j] = v;
+      }
+      constexpr uint8_t mid = (ADC_SCAN_SAMPLES) / 2;
+      filtered[i] = ((ADC_SCAN_SAMPLES) & 1)
+        ? s[mid] * (OVERSAMPLENR)
+        : (uint32_t(s[mid - 1]) + s[mid]) * (OVERSAMPLENR) / 2;
+
+    #else
+
+      uint32_t sum = 0;
+      for (uint8_t n = 0; n < ADC_SCAN_SAMPLES; ++n) sum += buffer[n][i];
+      const uint32_t mean = sum * (OVERSAMPLENR) / (ADC_SCAN_SAMPLES);
+
+      #if ADC_SCAN_FILTER == ADC_FILTER_IIR
+        // Smooth the mean over control periods. Start from the first one.
+        uint32_t &acc = iir_acc[i];
+        if (!acc) acc = mean << (ADC_SCAN_IIR_SHIFT);
+        acc = acc - (acc >> (ADC_SCAN_IIR_SHIFT)) + mean;
+        filtered[i] = acc >> (ADC_SCAN_IIR_SHIFT);
+      #else
+        filtered[i] = mean;
+      #endif
+
+    #endif
+  }
+}
+
+#endif // ADC_CONTINUOUS_SCAN
@@ -0,0 +1,99 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * adc_scan.h - Continuous ADC scan with digital filtering
+ *
+ * The HAL converts all the analog inputs in turn, over and over, into a ring
+ * of ADC_SCAN_SAMPLES rows. On STM32 this is done by DMA, on Linux by the
+ * simulation thread. Instead of starting a conversion for each sensor the
+ * temperature ISR calls filter() once per control period and takes the
+ * filtered values, scaled to match an OVERSAMPLENR sum of readings.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+enum ADCScanIndex : uint8_t {
+  OPTITEM(HAS_TEMP_ADC_0,         ADC_SCAN_TEMP_0)
+  OPTITEM(HAS_TEMP_ADC_1,         ADC_SCAN_TEMP_1)
+  OPTITEM(HAS_TEMP_ADC_2,         ADC_SCAN_TEMP_2)
+  OPTITEM(HAS_TEMP_ADC_3,         ADC_SCAN_TEMP_3)
+  OPTITEM(HAS_TEMP_ADC_4,         ADC_SCAN_TEMP_4)
+  OPTITEM(HAS_TEMP_ADC_5,         ADC_SCAN_TEMP_5)
+  OPTITEM(HAS_TEMP_ADC_6,         ADC_SCAN_TEMP_6)
+  OPTITEM(HAS_TEMP_ADC_7,         ADC_SCAN_TEMP_7)
+  OPTITEM(HAS_TEMP_ADC_BED,       ADC_SCAN_TEMP_BED)
+  OPTITEM(HAS_TEMP_ADC_CHAMBER,   ADC_SCAN_TEMP_CHAMBER)
+  OPTITEM(HAS_TEMP_ADC_PROBE,     ADC_SCAN_TEMP_PROBE)
+  OPTITEM(HAS_TEMP_ADC_COOLER,    ADC_SCAN_TEMP_COOLER)
+  OPTITEM(HAS_TEMP_ADC_BOARD,     ADC_SCAN_TEMP_BOARD)
+  OPTITEM(HAS_TEMP_ADC_REDUNDANT, ADC_SCAN_TEMP_REDUNDANT)
+  OPTITEM(FILAMENT_WIDTH_SENSOR,  ADC_SCAN_FILWIDTH)
+  OPTITEM(HAS_ADC_BUTTONS,        ADC_SCAN_ADC_KEY)
+  OPTITEM(HAS_JOY_ADC_X,          ADC_SCAN_JOY_X)
+  OPTITEM(HAS_JOY_ADC_Y,          ADC_SCAN_JOY_Y)
+  OPTITEM(HAS_JOY_ADC_Z,          ADC_SCAN_JOY_Z)
+  OPTITEM(POWER_MONITOR_CURRENT,  ADC_SCAN_POWERMON_CURRENT)
+  OPTITEM(POWER_MONITOR_VOLTAGE,  ADC_SCAN_POWERMON_VOLTS)
+  ADC_SCAN_COUNT
+};
+
+class ADCScan {
+public:
+  // Written continuously by the HAL, one row per pass over all the channels
+  static volatile uint16_t buffer[ADC_SCAN_SAMPLES][ADC_SCAN_COUNT];
+
+  // The pin of each channel, in scan order
+  static const pin_t pins[ADC_SCAN_COUNT];
+
+  // Start the scan. Implemented by the HAL.
+  static void start();
+
+  // The next entry of the buffer to be written, counting along the rows. Implemented by the HAL.
+  static uint16_t write_pos();
+
+  // Filter the buffer for every channel. Called once per control period.
+  static void filter();
+
+  // The filtered value of a channel, scaled like an OVERSAMPLENR sum
+  static raw_adc_t value(const ADCScanIndex i) { return filtered[i]; }
+
+  // The latest single reading, for inputs that are polled (buttons, joystick)
+  static uint16_t reading(const uint8_t i) {
+    constexpr uint16_t size = ADC_SCAN_SAMPLES * ADC_SCAN_COUNT;
+    const uint16_t last = write_pos() + size - 1,                     // The last entry written
+                   e = (last - (last - i) % ADC_SCAN_COUNT) % size;   // The last entry of this channel
+    return buffer[e / ADC_SCAN_COUNT][e % ADC_SCAN_COUNT];
+  }
+
+  // Channel index of a pin, or -1 if it isn't scanned
+  static int8_t index(const pin_t pin);
+
+private:
+  static raw_adc_t filtered[ADC_SCAN_COUNT];
+  #if ADC_SCAN_FILTER == ADC_FILTER_IIR
+    static uint32_t iir_acc[ADC_SCAN_COUNT];
+  #endif
+};
+
+extern ADCScan adc_scan;
@@ -186,6 +186,10 @@
   #include "feature/cancel_object.h"
 #endif
 
+#if ENABLED(WELL_PLATE_ARRAY)
+  #include "feature/plate_array.h"
+#endif
+
 #if HAS_FILAMENT_SENSOR
   #include "feature/runout.h"
 #endif
@@ -260,6 +264,30 @@
   #include "feature/peltier_control.h"
 #endif
 
+#if ENABLED(ISR_CYCLE_STATS)
+  #include "feature/isr_stats.h"
+#endif
+
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+  #include "feature/print_time_estimator.h"
+#endif
+
+#if ENABLED(SD_LOG)
+  #include "feature/sd_log.h"
+#endif
+
+#if ENABLED(TOOLCHANGE_PRECONDITION)
+  #include "feature/tool_precondition.h"
+#endif
+
+#if ENABLED(SYRINGE_MONITOR)
+  #include "feature/syringe_monitor.h"
+#endif
+
+#if ENABLED(SYRINGE_VOLUME)
+  #include "feature/syringe_volume.h"
+#endif
+
 PGMSTR(M112_KILL_STR, "M112 Shutdown");
 
 MarlinState marlin_state = MF_INITIALIZING;
@@ -395,6 +423,7 @@ void startOrResumeJob() {
     card.abortFilePrintNow(TERN_(SD_RESORT, true));
 
     queue.clear();
+    TERN_(WELL_PLATE_ARRAY, plate_array.end());
     quickstop_stepper();
 
     print_job_timer.abort();
@@ -766,6 +795,8 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
 
   TERN_(MONITOR_DRIVER_STATUS, monitor_tmc_drivers());
 
+  TERN_(SYRINGE_MONITOR, syringe_monitor.update());
+
   TERN_(MONITOR_L6470_DRIVER_STATUS, L64xxManager.monitor_driver());
 
   // Limit check_axes_activity frequency to 10Hz
@@ -858,12 +889,24 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
 
+  // Sample telemetry and write full SD log blocks
+  TERN_(SD_LOG, sd_log.idle());
+
+  // Heat or cool the next tool ahead of its tool-change
+  TERN_(TOOLCHANGE_PRECONDITION, tool_precondition.update());
+
   // Announce Host Keepalive state (if any)
   TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
 
   // Update the Print Job Timer state
   TERN_(PRINTCOUNTER, print_job_timer.tick());
 
+  // Re-derive multistepping limits from measured ISR cycles
+  TERN_(ISR_CYCLE_STATS_AUTO_LIMITS, isr_stats.task());
+
+  // Retire planner blocks in place of the Stepper ISR
+  TERN_(PRINT_TIME_ESTIMATOR, estimator.task());
+
   // Update the Beeper queue
   TERN_(USE_BEEPER, buzzer.tick());
 
@@ -1392,6 +1435,10 @@ void setup() {
   SETUP_RUN(settings.first_load());   // Load data from EEPROM if available (or use defaults)
                                       // This also updates variables in the planner, elsewhere
 
+  #if ENABLED(SYRINGE_VOLUME)
+    SETUP_RUN(syringe_volume.fill_all()); // Syringes start out full
+  #endif
+
   #if BOTH(HAS_WIRED_LCD, SHOW_BOOTSCREEN)
     SETUP_RUN(ui.show_bootscreen());
     const millis_t bootscreen_ms = millis();
@@ -1423,6 +1470,10 @@ void setup() {
     SETUP_RUN(refresh_delta_clip_start_height()); // Init safe delta height without soft endstops
   #endif
 
+  #if ENABLED(ISR_CYCLE_STATS)
+    SETUP_RUN(isr_stats.init());      // Clear ISR stats and set estimated step limits
+  #endif
+
   SETUP_RUN(stepper.init());          // Init stepper. This enables interrupts!
 
   #if HAS_SERVOS
@@ -32,14 +32,14 @@ CancelObject cancelable;
 
 int8_t CancelObject::object_count, // = 0
        CancelObject::active_object = -1;
-uint32_t CancelObject::canceled; // = 0x0000
+uint32_t CancelObject::canceled[(CANCEL_OBJECTS_MAX + 31) / 32]; // = { 0 }
 bool CancelObject::skipping; // = false
 
 void CancelObject::set_active_object(const int8_t obj) {
   active_object = obj;
-  if (WITHIN(obj, 0, 31)) {
+  if (WITHIN(obj, 0, CANCEL_OBJECTS_MAX - 1)) {
     if (obj >= object_count) object_count = obj + 1;
-    skipping = TEST(canceled, obj);
+    skipping = is_canceled(obj);
   }
   else
     skipping = false;
@@ -53,15 +53,15 @@ void CancelObject::set_active_object(const int8_t obj) {
 }
 
 void CancelObject::cancel_object(const int8_t obj) {
-  if (WITHIN(obj, 0, 31)) {
-    SBI(canceled, obj);
+  if (WITHIN(obj, 0, CANCEL_OBJECTS_MAX - 1)) {
+    SBI32(canceled[obj >> 5], obj & 0x1F);
     if (obj == active_object) skipping = true;
   }
 }
 
 void CancelObject::uncancel_object(const int8_t obj) {
-  if (WITHIN(obj, 0, 31)) {
-    CBI(canceled, obj);
+  if (WITHIN(obj, 0, CANCEL_OBJECTS_MAX - 1)) {
+    CBI32(canceled[obj >> 5], obj & 0x1F);
     if (obj == active_object) skipping = false;
   }
 }
@@ -70,11 +70,11 @@ void CancelObject::report() {
   if (active_object >= 0)
     SERIAL_ECHO_MSG("Active Object: ", active_object);
 
-  if (canceled) {
+  if (any_canceled()) {
     SERIAL_ECHO_START();
     SERIAL_ECHOPGM("Canceled:");
     for (int i = 0; i < object_count; i++)
-      if (TEST(canceled, i)) { SERIAL_CHAR(' '); SERIAL_ECHO(i); }
+      if (is_canceled(i)) { SERIAL_CHAR(' '); SERIAL_ECHO(i); }
     SERIAL_EOL();
   }
 }
@@ -21,21 +21,22 @@
  */
 #pragma once
 
-#include <stdint.h>
+#include "../inc/MarlinConfigPre.h"
 
 class CancelObject {
 public:
   static bool skipping;
   static int8_t object_count, active_object;
-  static uint32_t canceled;
+  static uint32_t canceled[(CANCEL_OBJECTS_MAX + 31) / 32];
   static void set_active_object(const int8_t obj);
   static void cancel_object(const int8_t obj);
   static void uncancel_object(const int8_t obj);
   static void report();
-  static bool is_canceled(const int8_t obj) { return TEST(canceled, obj); }
+  static bool is_canceled(const int8_t obj) { return TEST32(canceled[obj >> 5], obj & 0x1F); }
+  static bool any_canceled() { LOOP_L_N(i, COUNT(canceled)) if (canceled[i]) return true; return false; }
   static void clear_active_object() { set_active_object(-1); }
   static void cancel_active_object() { cancel_object(active_object); }
-  static void reset() { canceled = 0x0000; object_count = 0; clear_active_object(); }
+  static void reset() { ZERO(canceled); object_count = 0; clear_active_object(); }
 };
 
 extern CancelObject cancelable;
@@ -72,6 +72,15 @@ namespace DirectStepping {
   template<typename Cfg>
   typename Cfg::write_byte_idx_t SerialPageManager<Cfg>::write_page_size;
 
+  #if ENABLED(DIRECT_STEPPING_RLE)
+    template<typename Cfg> uint16_t SerialPageManager<Cfg>::rle_remaining;
+    template<typename Cfg> uint16_t SerialPageManager<Cfg>::rle_segment;
+    template<typename Cfg> uint8_t SerialPageManager<Cfg>::rle_axis;
+    template<typename Cfg> uint8_t SerialPageManager<Cfg>::rle_value;
+    template<typename Cfg> bool SerialPageManager<Cfg>::rle_long;
+    template<typename Cfg> bool SerialPageManager<Cfg>::rle_error;
+  #endif
+
   template <typename Cfg>
   void SerialPageManager<Cfg>::init() {
     for (int i = 0 ; i < Cfg::PAGE_COUNT ; i++)
@@ -102,6 +111,11 @@ namespace DirectStepping {
           case Cfg::CONTROL_CHAR:
             state = State::ADDRESS;
             return true;
+          #if ENABLED(DIRECT_STEPPING_RLE)
+            case Cfg::RLE_CHAR:
+              state = State::ADDRESS_RLE;
+              return true;
+          #endif
           case '\n':
           case '\r':
             state = State::NEWLINE;
@@ -110,7 +124,10 @@ namespace DirectStepping {
             state = State::MONITOR;
             return false;
         }
-      case State::ADDRESS:
+      #if ENABLED(DIRECT_STEPPING_RLE)
+        case State::ADDRESS_RLE:
+      #endif
+      case State::ADDRESS: {
         //TODO: 16 bit address, State::ADDRESS2
         write_page_idx = c;
         write_byte_idx = 0;
@@ -126,9 +143,20 @@ namespace DirectStepping {
 
         set_page_state(write_page_idx, PageState::WRITING);
 
+        #if ENABLED(DIRECT_STEPPING_RLE)
+          // Raw pages are always complete
+          const bool rle = state == State::ADDRESS_RLE;
+          rle_axis = rle ? 0 : Cfg::AXIS_COUNT;
+          rle_segment = 0;
+          rle_value = Cfg::ZERO_VALUE;
+          rle_long = rle_error = false;
+          if (rle) { state = State::SIZE_RLE; return true; }
+        #endif
+
         state = Cfg::DIRECTIONAL ? State::COLLECT : State::SIZE;
 
         return true;
+      }
       case State::SIZE:
         // Zero means full page size
         write_page_size = c;
@@ -154,8 +182,48 @@ namespace DirectStepping {
 
         state = State::CHECKSUM;
         return true;
+
+      #if ENABLED(DIRECT_STEPPING_RLE)
+        case State::SIZE_RLE:
+          rle_remaining = c;
+          state = State::SIZE_RLE2;
+          return true;
+        case State::SIZE_RLE2:
+          rle_remaining |= uint16_t(c) << 8;
+          state = rle_remaining ? State::COLLECT_RLE : State::CHECKSUM;
+          return true;
+        case State::COLLECT_RLE:
+          checksum ^= c;
+
+          // Keep reading to the end of the frame after an error
+          if (!rle_error) {
+            uint16_t count;
+            if (rle_long) {
+              rle_long = false;
+              count = c + 1;
+            }
+            else if (c == 0x0F) {
+              rle_long = true;
+              count = 0;
+            }
+            else if (c < 0x10) {
+              rle_value = c;
+              count = 1;
+            }
+            else {
+              rle_value += (c >> 4) - 8;
+              count = (c & 0xF) + 1;
+            }
+            if (count && !store_run(count)) rle_error = true;
+          }
+
+          if (!--rle_remaining) state = State::CHECKSUM;
+          return true;
+      #endif
+
       case State::CHECKSUM: {
-        const PageState page_state = (checksum == c) ? PageState::OK : PageState::FAIL;
+        const bool ok = checksum == c && TERN1(DIRECT_STEPPING_RLE, !rle_error && !rle_long && rle_axis == Cfg::AXIS_COUNT);
+        const PageState page_state = ok ? PageState::OK : PageState::FAIL;
         set_page_state(write_page_idx, page_state);
         state = State::MONITOR;
         return true;
@@ -171,6 +239,40 @@ namespace DirectStepping {
     }
   }
 
+  #if ENABLED(DIRECT_STEPPING_RLE)
+
+    // Set the next count segments of the current axis to rle_value
+    template<typename Cfg>
+    FORCE_INLINE bool SerialPageManager<Cfg>::store_run(uint16_t count) {
+      if (rle_axis >= Cfg::AXIS_COUNT || rle_value > Cfg::MAX_VALUE || rle_segment + count > Cfg::SEGMENTS)
+        return false;
+
+      constexpr uint8_t mask = Cfg::NUM_SEGMENTS - 1;
+      uint8_t * const page = pages[write_page_idx];
+      const uint8_t a = rle_axis;
+      for (; count; --count, ++rle_segment) {
+        // Same layout as the stepper reads
+        const uint16_t s = rle_segment;
+        uint16_t i;
+        uint8_t shift;
+        switch (Cfg::BITS_SEGMENT) {
+          case 4:  i = s * 2 + (a >> 1); shift = (a & 1) ? 0 : 4; break;
+          case 2:  i = s; shift = 6 - 2 * a; break;
+          default: i = s >> 1; shift = (s & 1) * 4 + 3 - a; break;
+        }
+        page[i] = (page[i] & ~(mask << shift)) | (rle_value << shift);
+      }
+
+      if (rle_segment == Cfg::SEGMENTS) {
+        rle_segment = 0;
+        rle_value = Cfg::ZERO_VALUE;
+        rle_axis++;
+      }
+      return true;
+    }
+
+  #endif
+
   template <typename Cfg>
   void SerialPageManager<Cfg>::write_responses() {
     if (fatal_error) {
@@ -27,6 +27,9 @@ namespace DirectStepping {
 
   enum State : char {
     MONITOR, NEWLINE, ADDRESS, SIZE, COLLECT, CHECKSUM, UNFAIL
+    #if ENABLED(DIRECT_STEPPING_RLE)
+      , ADDRESS_RLE, SIZE_RLE, SIZE_RLE2, COLLECT_RLE
+    #endif
   };
 
   enum PageState : uint8_t {
@@ -78,6 +81,22 @@ namespace DirectStepping {
     static write_byte_idx_t write_page_size;
 
     static void set_page_state(const page_idx_t page_idx, const PageState page_state);
+
+    #if ENABLED(DIRECT_STEPPING_RLE)
+      /**
+       * Compressed pages carry the segment values of each axis in turn, as tokens:
+       *   0x00-0x0E    Set the value, for one segment
+       *   0x0F n       Repeat the value for n + 1 segments
+       *   0xdc         Add d - 8 to the value, then repeat it for c + 1 segments
+       * Each axis starts at ZERO_VALUE. See buildroot/share/scripts/direct_stepping_pack.py
+       */
+      static uint16_t rle_remaining,  // Token bytes left in the frame
+                      rle_segment;    // Next segment of the current axis
+      static uint8_t rle_axis, rle_value;
+      static bool rle_long, rle_error;
+
+      static bool store_run(uint16_t count);
+    #endif
   };
 
   template<bool b, typename T, typename F> struct TypeSelector { typedef T type;} ;
@@ -86,6 +105,7 @@ namespace DirectStepping {
   template <int num_pages, int num_axes, int bits_segment, bool dir, int segments>
   struct config_t {
     static constexpr char CONTROL_CHAR  = '!';
+    static constexpr char RLE_CHAR      = '$';
 
     static constexpr int PAGE_COUNT     = num_pages;
     static constexpr int AXIS_COUNT     = num_axes;
@@ -97,6 +117,8 @@ namespace DirectStepping {
     static constexpr int SEGMENT_STEPS  = _BV(BITS_SEGMENT - DIRECTIONAL) - 1;
     static constexpr int TOTAL_STEPS    = SEGMENT_STEPS * SEGMENTS;
     static constexpr int PAGE_SIZE      = (AXIS_COUNT * BITS_SEGMENT * SEGMENTS) / 8;
+    static constexpr int ZERO_VALUE     = DIRECTIONAL ? SEGMENT_STEPS : 0;
+    static constexpr int MAX_VALUE      = NUM_SEGMENTS - 1 - DIRECTIONAL;
 
     typedef typename TypeSelector<(PAGE_SIZE>256), uint16_t, uint8_t>::type write_byte_idx_t;
     typedef typename TypeSelector<(PAGE_COUNT>256), uint16_t, uint8_t>::type page_idx_t;
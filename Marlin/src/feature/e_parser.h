@@ -70,7 +70,10 @@ public:
       EP_ctrl,
       EP_K, EP_KI, EP_KIL, EP_KILL,
     #endif
-    EP_IGNORE // to '\n'
+    EP_IGNORE, // to '\n'
+    #if ENABLED(PACKED_GCODE)
+      EP_PACKED  // Packed frame size. Above this, the frame bytes left to skip.
+    #endif
   };
 
   static bool killed_by_M112;
@@ -86,10 +89,25 @@ public:
   FORCE_INLINE static void disable() { enabled = false; }
 
   FORCE_INLINE static void update(State &state, const uint8_t c) {
+    #if ENABLED(PACKED_GCODE)
+      // Binary frames may contain anything, so skip over them
+      if (state >= EP_PACKED) {
+        if (state == EP_PACKED)
+          state = c <= PACKED_GCODE_MAX_SIZE ? State(EP_PACKED + c + 2) : EP_IGNORE;
+        else if (state == EP_PACKED + 1)
+          state = EP_RESET;
+        else
+          state = State(state - 1);
+        return;
+      }
+    #endif
     switch (state) {
       case EP_RESET:
         switch (c) {
           case ' ': case '\n': case '\r': break;
+          #if ENABLED(PACKED_GCODE)
+            case PACKED_GCODE_SYNC: state = EP_PACKED; break;
+          #endif
           case 'N': state = EP_N; break;
           case 'M': state = EP_M; break;
           #if ENABLED(REALTIME_REPORTING_COMMANDS)
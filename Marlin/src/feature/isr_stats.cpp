@@ -0,0 +1,119 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(ISR_CYCLE_STATS)
+
+#include "isr_stats.h"
+#include "../module/stepper.h"
+
+ISRStats isr_stats;
+
+isr_cycle_stat_t ISRStats::stat[ISR_STAT_COUNT];
+
+uint32_t ISRStats::step_limit[8];
+
+void ISRStats::init() {
+  reset();
+  default_step_limits();
+}
+
+void ISRStats::reset() {
+  CRITICAL_SECTION_START();
+  LOOP_L_N(i, ISR_STAT_COUNT) stat[i].reset();
+  CRITICAL_SECTION_END();
+}
+
+void ISRStats::default_step_limits() {
+  step_limit[0] =   MAX_STEP_ISR_FREQUENCY_1X;
+  step_limit[1] =   MAX_STEP_ISR_FREQUENCY_2X >> 1;
+  step_limit[2] =   MAX_STEP_ISR_FREQUENCY_4X >> 2;
+  step_limit[3] =   MAX_STEP_ISR_FREQUENCY_8X >> 3;
+  step_limit[4] =  MAX_STEP_ISR_FREQUENCY_16X >> 4;
+  step_limit[5] =  MAX_STEP_ISR_FREQUENCY_32X >> 5;
+  step_limit[6] =  MAX_STEP_ISR_FREQUENCY_64X >> 6;
+  step_limit[7] = MAX_STEP_ISR_FREQUENCY_128X >> 7;
+}
+
+/**
+ * Same model as ISR_EXECUTION_CYCLES(R) in stepper.h, with measured values:
+ *  - Base cycles are the average Stepper ISR time spent outside of pulsing,
+ *    which includes the block phase and Linear Advance.
+ *  - Loop cycles are the worst case time to pulse one step event.
+ */
+bool ISRStats::apply_step_limits() {
+  CRITICAL_SECTION_START();
+  const uint32_t samples = stat[ISR_STAT_STEPPER].count,
+                 base = stat[ISR_STAT_STEPPER_BASE].avg(),
+                 loop = stat[ISR_STAT_STEP_LOOP].max;
+  CRITICAL_SECTION_END();
+
+  if (samples < (ISR_CYCLE_STATS_MIN_SAMPLES) || !loop) return false;
+
+  LOOP_L_N(i, COUNT(step_limit)) {
+    const uint32_t r = _BV(i),
+                   cycles = (base + loop * r) * (100 + (ISR_CYCLE_STATS_MARGIN)) / 100 / r;
+    step_limit[i] = ((F_CPU) / _MAX(cycles, 1U)) >> i;
+  }
+  return true;
+}
+
+#if ENABLED(ISR_CYCLE_STATS_AUTO_LIMITS)
+
+  // Re-derive the step limits every few seconds as new samples come in
+  void ISRStats::task() {
+    static millis_t next_ms = 0;
+    const millis_t ms = millis();
+    if (ELAPSED(ms, next_ms)) {
+      next_ms = ms + 5000UL;
+      apply_step_limits();
+    }
+  }
+
+#endif
+
+void ISRStats::report() {
+  auto echo_stat = [](FSTR_P const name, const ISRStatIndex i) {
+    CRITICAL_SECTION_START();
+    const isr_cycle_stat_t s = stat[i];
+    CRITICAL_SECTION_END();
+    SERIAL_ECHOF(name);
+    if (s.count)
+      SERIAL_ECHOLNPGM(" min:", s.min, " avg:", s.avg(), " max:", s.max, " n:", s.count);
+    else
+      SERIAL_ECHOLNPGM(" n:0");
+  };
+
+  SERIAL_ECHOLNPGM("ISR cycles at ", uint32_t(F_CPU), "Hz");
+  echo_stat(F("Stepper ISR:"), ISR_STAT_STEPPER);
+  echo_stat(F("Stepper base:"), ISR_STAT_STEPPER_BASE);
+  echo_stat(F("Step loop:"), ISR_STAT_STEP_LOOP);
+  echo_stat(F("Block phase:"), ISR_STAT_BLOCK_PHASE);
+  echo_stat(F("Temperature ISR:"), ISR_STAT_TEMPERATURE);
+
+  SERIAL_ECHOPGM("Step limits (Hz):");
+  LOOP_L_N(i, COUNT(step_limit)) SERIAL_ECHOPGM(" ", _BV(i), "x:", step_limit[i]);
+  SERIAL_EOL();
+}
+
+#endif // ISR_CYCLE_STATS
@@ -0,0 +1,90 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/isr_stats.h - Runtime ISR cycle accounting
+ *
+ * Measures the cycles actually spent in the Stepper, block phase and
+ * Temperature ISRs with the HAL cycle counter, and derives multistepping
+ * limits from the measured values instead of the ISR_*_CYCLES estimates.
+ *
+ * The Stepper ISR runs with interrupts enabled, so its figures include
+ * the time of any serial, USB or timer ISR that preempts it. This mostly
+ * raises the max, which makes the derived limits lower and so safer.
+ * Only Stepper ISR calls that ran the pulse phase are counted.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+enum ISRStatIndex : uint8_t {
+  ISR_STAT_STEPPER,       // Whole Stepper::isr() call
+  ISR_STAT_STEPPER_BASE,  // Stepper::isr() call, less the time spent pulsing
+  ISR_STAT_STEP_LOOP,     // Pulse phase, per step event
+  ISR_STAT_BLOCK_PHASE,   // Stepper::block_phase_isr()
+  ISR_STAT_TEMPERATURE,   // Temperature::isr()
+  ISR_STAT_COUNT
+};
+
+typedef struct {
+  uint32_t min, max, count;
+  uint64_t total;
+
+  void reset() { min = UINT32_MAX; max = count = 0; total = 0; }
+  void sample(const uint32_t cycles) {
+    NOMORE(min, cycles);
+    NOLESS(max, cycles);
+    total += cycles;
+    count++;
+  }
+  uint32_t avg() const { return count ? uint32_t(total / count) : 0; }
+} isr_cycle_stat_t;
+
+class ISRStats {
+public:
+  static isr_cycle_stat_t stat[ISR_STAT_COUNT];
+
+  // Stepping frequency limits for each multistepping rate (1x to 128x), used by Stepper::calc_timer_interval
+  static uint32_t step_limit[8];
+
+  static void init();
+  static void reset();
+  static void report();
+
+  // Get the ISR start time
+  static uint32_t start() { return hal.cycle_count(); }
+
+  // Record the cycles elapsed since the given start time
+  static void sample(const ISRStatIndex i, const uint32_t start_cycles) { stat[i].sample(hal.cycle_count() - start_cycles); }
+
+  // Derive step limits from the measured cycles. Return false if there aren't enough samples yet.
+  static bool apply_step_limits();
+
+  // Restore the estimated step limits from stepper.h
+  static void default_step_limits();
+
+  #if ENABLED(ISR_CYCLE_STATS_AUTO_LIMITS)
+    static void task();
+  #endif
+};
+
+extern ISRStats isr_stats;
@@ -0,0 +1,148 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "../inc/MarlinConfig.h"
+
+#if HAS_PACKED_COMMANDS
+
+#include "packed_gcode.h"
+
+PackedGCode packed_gcode;
+
+bool PackedGCode::store(char * const buffer, char *end, const packed_gcode_t &h, const float value[26]) {
+  uint8_t count = 0;
+  LOOP_L_N(i, 26) if (TEST32(h.valbits, i)) count++;
+  if ((end + 1 - buffer) + sizeof(h) + count * sizeof(float) > MAX_CMD_SIZE) return false;
+
+  *end++ = '\0';
+  memcpy(end, &h, sizeof(h));
+  end += sizeof(h);
+  LOOP_L_N(i, 26)
+    if (TEST32(h.valbits, i)) { memcpy(end, &value[i], sizeof(float)); end += sizeof(float); }
+  return true;
+}
+
+uint8_t PackedGCode::length(const char * const buffer) {
+  const uint8_t word = strlen(buffer) + 1;
+  packed_gcode_t h;
+  memcpy(&h, buffer + word, sizeof(h));
+  uint8_t count = 0;
+  LOOP_L_N(i, 26) if (TEST32(h.valbits, i)) count++;
+  return word + sizeof(h) + count * sizeof(float);
+}
+
+#endif // HAS_PACKED_COMMANDS
+
+#if ENABLED(PACKED_GCODE)
+
+#include "packed_gcode.h"
+#include "../libs/crc16.h"
+
+int32_t PackedGCode::last_value[NUM_SERIAL][26]; // = { 0 }
+
+// Read a LEB128 varint of up to 32 bits
+static bool read_varint(const uint8_t * &p, const uint8_t * const end, uint32_t &v) {
+  v = 0;
+  for (uint8_t shift = 0; shift < 35; shift += 7) {
+    if (p >= end) return false;
+    const uint8_t b = *p++;
+    v |= uint32_t(b & 0x7F) << shift;
+    if (!(b & 0x80)) return true;
+  }
+  return false;
+}
+
+static int32_t unzigzag(const uint32_t v) { return int32_t(v >> 1) ^ -int32_t(v & 1); }
+
+bool PackedGCode::check(const uint8_t * const frame, long &line, bool &numbered) {
+  const uint8_t size = frame[1];
+  if (size < 2 || size > PACKED_GCODE_MAX_SIZE) return false;
+
+  uint16_t crc = 0;
+  crc16(&crc, &frame[1], size + 1);
+  if (crc != (frame[size + 2] | (frame[size + 3] << 8))) return false;
+
+  numbered = TEST(frame[2], 3);
+  if (numbered) {
+    const uint8_t *p = &frame[3];
+    uint32_t n;
+    if (!read_varint(p, &frame[size + 2], n)) return false;
+    line = n;
+  }
+  return true;
+}
+
+bool PackedGCode::decode(const uint8_t * const frame, const serial_index_t serial_ind, char * const buffer) {
+  const uint8_t *p = &frame[3], * const end = &frame[frame[1] + 2];
+  const uint8_t flags = frame[2];
+  if ((flags & 0x03) == 0x03) return false;
+
+  packed_gcode_t h;
+  h.letter = "GMT"[flags & 0x03];
+  uint32_t line = 0, code;
+  if (TEST(flags, 3) && !read_varint(p, end, line)) return false;
+  if (!read_varint(p, end, code) || code > 0xFFFF) return false;
+  h.codenum = code;
+  h.subcode = 0;
+  if (TEST(flags, 2)) {
+    if (p >= end) return false;
+    h.subcode = *p++;
+  }
+
+  // Values are applied only once the whole frame is good
+  float value[26];
+  int32_t fixed[26];
+  uint32_t fixed_bits = 0;
+  int32_t * const last = last_value[serial_ind.index];
+  h.codebits = h.valbits = 0;
+  while (p < end) {
+    const uint8_t ind = *p & 0x1F, type = *p++ >> 5;
+    if (ind >= COUNT(value)) return false;
+    SBI32(h.codebits, ind);
+    if (type == 0) { CBI32(h.valbits, ind); continue; }
+
+    uint32_t v;
+    if (type > 3 || !read_varint(p, end, v)) return false;
+    SBI32(h.valbits, ind);
+    const int32_t i = unzigzag(v);
+    if (type == 1) {
+      value[ind] = i;
+      continue;
+    }
+    fixed[ind] = type == 2 ? i : (TEST32(fixed_bits, ind) ? fixed[ind] : last[ind]) + i;
+    SBI32(fixed_bits, ind);
+    value[ind] = fixed[ind] / 100000.0f;
+  }
+
+  // The command word, for echo and the line number of the "ok"
+  char *b = buffer;
+  if (TEST(flags, 3)) b += sprintf_P(b, PSTR("N%lu "), (unsigned long)line);
+  b += sprintf_P(b, PSTR("%c%u"), h.letter, h.codenum);
+  if (TEST(flags, 2)) b += sprintf_P(b, PSTR(".%u"), h.subcode);
+  if (!store(buffer, b, h, value)) return false;
+
+  LOOP_L_N(i, COUNT(fixed)) if (TEST32(fixed_bits, i)) last[i] = fixed[i];
+  return true;
+}
+
+#endif // PACKED_GCODE
@@ -0,0 +1,90 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/packed_gcode.h - Binary G-code frames on the serial ports
+ *
+ * A host may send a frame in place of any text line:
+ *
+ *   0xF5 <size> <body> <crc lo> <crc hi>
+ *
+ * 0xF5 never occurs in UTF-8 text so it can only start a frame. The size
+ * counts the body bytes and the CRC16 (see libs/crc16) covers size and body.
+ *
+ * Body:
+ *   flags    Bits 0-1: 0=G 1=M 2=T. Bit 2: subcode follows. Bit 3: line number follows.
+ *   [line]   Line number, varint. Checked like the N of a text line.
+ *   codenum  Varint
+ *   [sub]    Subcode, one byte
+ *   params   One byte each (bits 0-4: letter A-Z as 0-25, bits 5-7: type) then the value:
+ *              0  No value
+ *              1  Integer, zigzag varint
+ *              2  Fixed point, zigzag varint in 0.00001 units
+ *              3  Delta, zigzag varint in 0.00001 units added to the last
+ *                 fixed point or delta value of the same letter
+ *
+ * Varints are LEB128, up to 32 bits. Fixed point and delta values are kept
+ * per port as 32-bit integers so a host can track them exactly. They only
+ * change when a frame is accepted, so after a "Resend:" the host encodes
+ * again from the last line acknowledged. Send M110 and commands with
+ * string arguments as text.
+ *
+ * The frame is decoded straight into a command queue slot as the command
+ * word (e.g., "N12 G1") followed by a packed_gcode_t and its values as
+ * floats, which the parser uses without any text parsing. GCODE_PREPARSE
+ * stores queued text commands the same way.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+typedef struct {
+  char     letter;              // G, M, or T
+  uint8_t  subcode;
+  uint16_t codenum;
+  uint32_t codebits,            // Parameters seen
+           valbits;             // Parameters with a value, stored as floats in A-Z order after this header
+} packed_gcode_t;
+
+class PackedGCode {
+public:
+  #if ENABLED(PACKED_GCODE)
+    // Verify the CRC and get the line number, if any. The frame includes the sync byte.
+    static bool check(const uint8_t * const frame, long &line, bool &numbered);
+
+    // Decode a checked frame into a command buffer and update the port's values
+    static bool decode(const uint8_t * const frame, const serial_index_t serial_ind, char * const buffer);
+  #endif
+
+  // Store the header and values after the command word ending at 'end'. False if they don't fit.
+  static bool store(char * const buffer, char *end, const packed_gcode_t &h, const float value[26]);
+
+  // Bytes used by a command stored with store()
+  static uint8_t length(const char * const buffer);
+
+private:
+  #if ENABLED(PACKED_GCODE)
+    static int32_t last_value[NUM_SERIAL][26];
+  #endif
+};
+
+extern PackedGCode packed_gcode;
@@ -0,0 +1,104 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(WELL_PLATE_ARRAY)
+
+#include "plate_array.h"
+#include "../module/motion.h"
+#include "../lcd/marlinui.h"
+
+#if ENABLED(CANCEL_OBJECTS)
+  #include "cancel_object.h"
+#endif
+
+PlateArray plate_array;
+
+uint8_t PlateArray::rows, PlateArray::cols, PlateArray::well;
+xy_pos_t PlateArray::pitch;
+xyz_pos_t PlateArray::origin, PlateArray::base_shift;
+float PlateArray::correction[WELL_PLATE_MAX_WELLS][XYZ];
+bool PlateArray::running, PlateArray::active;
+
+static bool is_canceled(const uint8_t w) { return TERN0(CANCEL_OBJECTS, cancelable.is_canceled(w)); }
+
+bool PlateArray::start(const uint8_t first) {
+  for (well = first; well < count() && is_canceled(well); ++well) { /* nada */ }
+  if (well >= count()) return false;
+
+  TERN_(CANCEL_OBJECTS, cancelable.object_count = count());
+  base_shift = position_shift;
+  running = true;
+  goto_well(well);
+  return true;
+}
+
+uint8_t PlateArray::next_well() {
+  do ++well; while (well < count() && is_canceled(well));
+  if (well >= count()) running = false;
+  return well;
+}
+
+void PlateArray::goto_well(const uint8_t w) {
+  if (w >= count()) return;
+
+  // The well center becomes X0 Y0 Z0 of the workspace
+  position_shift = base_shift;
+  position_shift.x -= origin.x + (w % cols) * pitch.x + correction[w][X_AXIS];
+  position_shift.y -= origin.y + (w / cols) * pitch.y + correction[w][Y_AXIS];
+  position_shift.z -= origin.z + correction[w][Z_AXIS];
+  LOOP_NUM_AXES(a) update_workspace_offset((AxisEnum)a);
+  active = true;
+
+  TERN_(CANCEL_OBJECTS, cancelable.set_active_object(w));
+  report_well(w);
+  #if HAS_STATUS_MESSAGE
+    ui.status_printf(0, F("Well %c%i"), 'A' + w / cols, w % cols + 1);
+  #endif
+}
+
+void PlateArray::end() {
+  running = false;
+  if (!active) return;
+  active = false;
+  position_shift = base_shift;
+  LOOP_NUM_AXES(a) update_workspace_offset((AxisEnum)a);
+  TERN_(CANCEL_OBJECTS, cancelable.clear_active_object());
+}
+
+void PlateArray::report_geometry() {
+  SERIAL_ECHOLNPGM(
+    "Plate R", rows, " C", cols, " I", pitch.x, " J", pitch.y,
+    " X", origin.x, " Y", origin.y, " Z", origin.z
+  );
+}
+
+void PlateArray::report_well(const uint8_t w) {
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPGM("Well ", w, " ");
+  SERIAL_CHAR('A' + w / cols);
+  SERIAL_ECHO(w % cols + 1);
+  SERIAL_ECHOLNPGM(" X", correction[w][X_AXIS], " Y", correction[w][Y_AXIS], " Z", correction[w][Z_AXIS]);
+}
+
+#endif // WELL_PLATE_ARRAY
@@ -0,0 +1,61 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/plate_array.h - Print the selected SD file once in each well of a plate
+ *
+ * Wells are numbered from 0 in rows (A1, A2, ... B1, ...), the same as
+ * M486 objects. Before each well the workspace is shifted by the well's
+ * position plus its correction, so the file is written for a single well
+ * centered at X0 Y0. The file is read again from the start for each well,
+ * and canceled wells are skipped without reading.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class PlateArray {
+public:
+  static uint8_t rows, cols;
+  static xy_pos_t pitch;                              // Distance between columns (X) and rows (Y)
+  static xyz_pos_t origin;                            // Center of well A1 in the workspace at the start
+  static float correction[WELL_PLATE_MAX_WELLS][XYZ]; // Per-well offset corrections
+
+  static bool running,    // Reading the file for the wells
+              active;     // The workspace is shifted to a well
+
+  static uint8_t count() { return rows * cols; }
+
+  static bool start(const uint8_t first);   // Start with the first well at or after 'first'
+  static uint8_t next_well();               // Next well to read, or count() when done
+  static void goto_well(const uint8_t w);   // Shift the workspace to a well
+  static void end();                        // Restore the workspace
+
+  static void report_geometry();
+  static void report_well(const uint8_t w);
+
+private:
+  static uint8_t well;
+  static xyz_pos_t base_shift;
+};
+
+extern PlateArray plate_array;
@@ -62,6 +62,10 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   #include "fwretract.h"
 #endif
 
+#if ENABLED(SYRINGE_VOLUME)
+  #include "syringe_volume.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_POWER_LOSS_RECOVERY)
 #include "../core/debug_out.h"
 
@@ -229,6 +233,8 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
       info.retract_hop = fwretract.current_hop;
     #endif
 
+    TERN_(SYRINGE_VOLUME, COPY(info.syringe_volume, syringe_volume.volume));
+
     // Elapsed print job time
     info.print_job_elapsed = print_job_timer.duration();
 
@@ -525,6 +531,9 @@ void PrintJobRecovery::resume() {
     fwretract.current_hop = info.retract_hop;
   #endif
 
+  // Syringes hold what they had at outage
+  TERN_(SYRINGE_VOLUME, COPY(syringe_volume.volume, info.syringe_volume));
+
   #if ENABLED(GRADIENT_MIX)
     memcpy(&mixer.gradient, &info.gradient, sizeof(info.gradient));
   #endif
@@ -679,6 +688,15 @@ void PrintJobRecovery::resume() {
           DEBUG_ECHOLNPGM("retract_hop: ", info.retract_hop);
         #endif
 
+        #if ENABLED(SYRINGE_VOLUME)
+          DEBUG_ECHOPGM("syringe_volume: ");
+          EXTRUDER_LOOP() {
+            DEBUG_ECHO(info.syringe_volume[e]);
+            if (e < EXTRUDERS - 1) DEBUG_CHAR(',');
+          }
+          DEBUG_EOL();
+        #endif
+
         // Mixing extruder and gradient
         #if BOTH(MIXING_EXTRUDER, GRADIENT_MIX)
           DEBUG_ECHOLNPGM("gradient: ", info.gradient.enabled ? "ON" : "OFF");
@@ -96,6 +96,10 @@ typedef struct {
     float retract[EXTRUDERS], retract_hop;
   #endif
 
+  #if ENABLED(SYRINGE_VOLUME)
+    float syringe_volume[EXTRUDERS];
+  #endif
+
   // Mixing extruder and gradient
   #if ENABLED(MIXING_EXTRUDER)
     //uint_fast8_t selected_vtool;
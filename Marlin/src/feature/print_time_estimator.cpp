@@ -0,0 +1,122 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+
+#include "print_time_estimator.h"
+#include "../module/stepper.h"
+#include "../libs/duration_t.h"
+#include "../MarlinCore.h"
+
+PrintTimeEstimator estimator;
+
+double PrintTimeEstimator::elapsed, // = 0
+       PrintTimeEstimator::layer_start;
+float PrintTimeEstimator::planned_z,
+      PrintTimeEstimator::layer_z;
+uint16_t PrintTimeEstimator::layer; // = 0
+volatile bool PrintTimeEstimator::input_done; // = false
+
+void PrintTimeEstimator::task() {
+  // Nothing to wait for on the host
+  wait_for_heatup = false;
+  TERN_(HAS_RESUME_CONTINUE, wait_for_user = false);
+
+  // The Stepper would be working on the oldest block while the planner waits
+  if (!planner.moves_free()) retire_block();
+}
+
+void PrintTimeEstimator::drain() {
+  while (planner.has_blocks_queued())
+    if (!retire_block()) idle();  // The first block may be held back for a moment
+}
+
+/**
+ * The time the Stepper ISR takes for a block: accelerate from initial_rate,
+ * cruise at nominal_rate, and decelerate to final_rate, all in step events.
+ */
+double PrintTimeEstimator::block_time(const block_t * const block) {
+  const uint32_t cruise_steps = block->decelerate_after - block->accelerate_until;
+
+  #if ENABLED(JERK_LIMITED_ACCELERATION)
+
+    // The planner already timed the jerk-limited ramps
+    return double(block->acceleration_time + block->deceleration_time) / (STEPPER_TIMER_RATE)
+         + double(cruise_steps) / _MAX(block->cruise_rate, 1U);
+
+  #else
+
+    const float accel = block->acceleration_steps_per_s2;
+    if (accel <= 0) return double(block->step_event_count) / _MAX(block->nominal_rate, 1U);
+
+    const uint32_t accel_steps = block->accelerate_until,
+                   decel_steps = block->step_event_count - block->decelerate_after;
+
+    // Peak rates at the end of acceleration and the start of deceleration
+    const float vi = block->initial_rate, vf = block->final_rate,
+                va = SQRT(sq(vi) + 2 * accel * accel_steps),
+                vd = SQRT(sq(vf) + 2 * accel * decel_steps);
+
+    double t = (va - vi) / accel + (vd - vf) / accel;
+    if (cruise_steps) t += double(cruise_steps) / _MAX(block->nominal_rate, 1U);
+    return t;
+
+  #endif
+}
+
+bool PrintTimeEstimator::retire_block() {
+  block_t * const block = planner.get_current_block();
+  if (!block) return false;
+
+  if (!TEST(block->flag, BLOCK_BIT_SYNC_POSITION) && block->step_event_count) {
+    // A new layer starts with the first extrusion at a higher Z
+    #if HAS_EXTRUDERS
+      if (block->steps.e && !TEST(block->direction_bits, E_AXIS) && (!layer || block->layer_z > layer_z + 0.001f)) {
+        if (layer) report_layer();
+        layer++;
+        layer_z = block->layer_z;
+        layer_start = elapsed;
+      }
+    #endif
+    elapsed += block_time(block);
+  }
+
+  stepper.skip_block(block);
+  planner.release_current_block();
+  return true;
+}
+
+void PrintTimeEstimator::report_layer() {
+  SERIAL_ECHOLNPGM("Estimate layer:", layer, " Z:", layer_z, " time:", elapsed - layer_start, "s");
+}
+
+void PrintTimeEstimator::finish() {
+  drain();
+  if (layer) report_layer();
+  char buffer[22];
+  duration_t(uint32_t(LROUND(elapsed))).toString(buffer);
+  SERIAL_ECHOLNPGM("Estimate layers:", layer, " total:", elapsed, "s (", buffer, ")");
+}
+
+#endif // PRINT_TIME_ESTIMATOR
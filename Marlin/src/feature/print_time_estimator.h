@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/print_time_estimator.h - Offline print time estimation
+ *
+ * For host builds (env:linux_native_estimator) the Stepper ISR never runs.
+ * Planner blocks are retired here whenever the planner needs a free block or
+ * waits for moves to finish, and each block is timed from its trapezoid.
+ * Dwells add their time, while heating and user waits are skipped.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../module/planner.h"
+
+class PrintTimeEstimator {
+public:
+  static double elapsed;          // Estimated time of all retired blocks (s)
+  static float planned_z;         // Unleveled Z of the move being planned
+  static volatile bool input_done;
+
+  // Retire a block if the planner is full. Called from idle().
+  static void task();
+
+  // Retire all queued blocks. Called by Planner::synchronize().
+  static void drain();
+
+  static void dwell(const millis_t ms) { elapsed += ms * 0.001; }
+
+  // Drain the planner and report the last layer and the total time
+  static void finish();
+
+private:
+  static uint16_t layer;
+  static float layer_z;
+  static double layer_start;
+
+  static bool retire_block();
+  static double block_time(const block_t * const block);
+  static void report_layer();
+};
+
+extern PrintTimeEstimator estimator;
@@ -31,18 +31,37 @@
 #include "../gcode/gcode.h"
 #include "../sd/cardreader.h"
 
+#if HAS_PACKED_COMMANDS
+  #include "packed_gcode.h"
+#endif
+#if ENABLED(POWER_LOSS_RECOVERY)
+  #include "powerloss.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_GCODE_REPEAT_MARKERS)
 #include "../core/debug_out.h"
 
 repeat_marker_t Repeat::marker[MAX_REPEAT_NESTING];
 uint8_t Repeat::index;
 
+#if ENABLED(GCODE_REPEAT_CACHE)
+  uint8_t Repeat::cache[GCODE_REPEAT_CACHE_SIZE];
+  uint16_t Repeat::cache_used, Repeat::replay_pos;
+  int8_t Repeat::cache_marker = -1;
+  bool Repeat::recording, Repeat::replaying;
+#endif
+
 void Repeat::add_marker(const uint32_t sdpos, const uint16_t count) {
   if (index >= MAX_REPEAT_NESTING)
     SERIAL_ECHO_MSG("!Too many markers.");
   else {
     marker[index].sdpos = sdpos;
     marker[index].counter = count ?: -1;
+    #if ENABLED(GCODE_REPEAT_CACHE)
+      cache_marker = index;             // Record the body of the new innermost loop
+      cache_used = 0;
+      recording = true;
+    #endif
     index++;
     DEBUG_ECHOLNPGM("Add Marker ", index, " at ", sdpos, " (", count, ")");
   }
@@ -56,9 +75,18 @@ void Repeat::loop() {
     if (!marker[ind].counter) {         // Did its counter run out?
       DEBUG_ECHOLNPGM("Pass Marker ", index);
       index--;                          //  Carry on. Previous marker on the next 'M808'.
+      TERN_(GCODE_REPEAT_CACHE, if (cache_marker == ind) drop_cache());
     }
     else {
-      card.setIndex(marker[ind].sdpos); // Loop back to the marker.
+      #if ENABLED(GCODE_REPEAT_CACHE)
+        recording = false;              // The body ends here
+        if (cache_marker == ind && cache_used) {
+          replaying = true;             // Replay it from RAM.
+          replay_pos = 0;
+        }
+        else
+      #endif
+          card.setIndex(marker[ind].sdpos); // Loop back to the marker.
       if (marker[ind].counter > 0)      // Ignore a negative (or zero) counter.
         --marker[ind].counter;          // Decrement the counter. If zero this 'M808' will be skipped next time.
       DEBUG_ECHOLNPGM("Goto Marker ", index, " at ", marker[ind].sdpos, " (", marker[ind].counter, ")");
@@ -68,6 +96,53 @@ void Repeat::loop() {
 
 void Repeat::cancel() { LOOP_L_N(i, index) marker[i].counter = 0; }
 
+#if ENABLED(GCODE_REPEAT_CACHE)
+
+  void Repeat::cache_command(char * const cmd, const bool packed) {
+    if (!recording || is_command_M808(cmd)) return;
+
+    // SD commands can change the file or its position
+    if (cmd[0] == 'M' && WITHIN(atoi(&cmd[1]), 20, 34)) { drop_cache(); return; }
+
+    repeat_cache_entry_t e;
+    e.length = strlen(cmd) + 1;
+    TERN_(HAS_PACKED_COMMANDS, if (packed) e.length = PackedGCode::length(cmd));
+    e.packed = packed;
+    TERN_(POWER_LOSS_RECOVERY, e.sdpos = recovery.cmd_sdpos);
+
+    if (cache_used + sizeof(e) + e.length > sizeof(cache)) {
+      DEBUG_ECHOLNPGM("Loop ", cache_marker + 1, " too big to cache");
+      drop_cache();
+      return;
+    }
+    memcpy(&cache[cache_used], &e, sizeof(e));
+    memcpy(&cache[cache_used + sizeof(e)], cmd, e.length);
+    cache_used += sizeof(e) + e.length;
+  }
+
+  bool Repeat::replay_command(char * const cmd, bool &packed) {
+    if (!replaying) return false;
+
+    // The end of the body acts as its closing 'M808'
+    if (replay_pos >= cache_used) {
+      loop();
+      if (!replaying) {
+        TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+        return false;
+      }
+    }
+
+    repeat_cache_entry_t e;
+    memcpy(&e, &cache[replay_pos], sizeof(e));
+    memcpy(cmd, &cache[replay_pos + sizeof(e)], e.length);
+    replay_pos += sizeof(e) + e.length;
+    packed = e.packed;
+    TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = e.sdpos);
+    return true;
+  }
+
+#endif // GCODE_REPEAT_CACHE
+
 void Repeat::early_parse_M808(char * const cmd) {
   if (is_command_M808(cmd)) {
     DEBUG_ECHOLNPGM("Parsing \"", cmd, "\"");
@@ -33,12 +33,31 @@ typedef struct {
   int16_t counter;  // The counter for looping
 } repeat_marker_t;
 
+#if ENABLED(GCODE_REPEAT_CACHE)
+  typedef struct {
+    uint8_t length;   // Bytes of the queued command that follow
+    bool packed;      // The command holds pre-parsed values
+    #if ENABLED(POWER_LOSS_RECOVERY)
+      uint32_t sdpos; // File position for Power-Loss Recovery
+    #endif
+  } repeat_cache_entry_t;
+#endif
+
 class Repeat {
 private:
   static repeat_marker_t marker[MAX_REPEAT_NESTING];
   static uint8_t index;
+
+  #if ENABLED(GCODE_REPEAT_CACHE)
+    static uint8_t cache[GCODE_REPEAT_CACHE_SIZE];  // Queued commands of the innermost loop body
+    static uint16_t cache_used, replay_pos;
+    static int8_t cache_marker;                     // Marker index of the cached body, or -1
+    static bool recording, replaying;
+    static void drop_cache() { cache_marker = -1; recording = replaying = false; }
+  #endif
+
 public:
-  static void reset() { index = 0; }
+  static void reset() { index = 0; TERN_(GCODE_REPEAT_CACHE, drop_cache()); }
   static bool is_active() {
     LOOP_L_N(i, index) if (marker[i].counter) return true;
     return false;
@@ -48,6 +67,14 @@ public:
   static void add_marker(const uint32_t sdpos, const uint16_t count);
   static void loop();
   static void cancel();
+
+  #if ENABLED(GCODE_REPEAT_CACHE)
+    static bool is_replaying() { return replaying; }
+    // Keep a command just queued from the file while its loop body is recorded
+    static void cache_command(char * const cmd, const bool packed);
+    // Get the next command of the loop being replayed. False when the loop is done.
+    static bool replay_command(char * const cmd, bool &packed);
+  #endif
 };
 
 extern Repeat repeat;
@@ -0,0 +1,205 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_LINE_INDEX)
+
+#include "sd_index.h"
+#include "../sd/cardreader.h"
+#include "../MarlinCore.h"
+
+#define SD_INDEX_MAGIC 0x31584449UL   // "IDX1"
+
+SDIndex sd_index;
+
+sd_index_header_t SDIndex::header; // = { 0 }
+uint32_t SDIndex::line_pos[SD_INDEX_SIZE], SDIndex::layer_pos[SD_INDEX_SIZE];
+
+bool SDIndex::get_identity(sd_index_header_t &id) {
+  dir_t d;
+  if (!card.isFileOpen() || !card.file.dirEntry(&d)) return false;
+  id.magic = SD_INDEX_MAGIC;
+  id.filesize = card.getFileSize();
+  id.cluster = card.file.firstCluster();
+  id.date = d.lastWriteDate;
+  id.time = d.lastWriteTime;
+  return true;
+}
+
+bool SDIndex::is_current() {
+  sd_index_header_t id;
+  return get_identity(id)
+      && header.magic == id.magic && header.filesize == id.filesize && header.cluster == id.cluster
+      && header.date == id.date && header.time == id.time;
+}
+
+// The first cluster is unique on the volume and fits an 8.3 name
+void SDIndex::sidecar_name(char * const name) {
+  sprintf_P(name, PSTR("/%08lX.IDX"), (unsigned long)card.file.firstCluster());
+}
+
+bool SDIndex::load() {
+  sd_index_header_t id, h;
+  if (!get_identity(id)) return false;
+
+  char name[14];
+  sidecar_name(name);
+  SdFile f;
+  if (!f.open(&card.root, name, O_READ)) return false;
+
+  const bool ok = f.read(&h, sizeof(h)) == sizeof(h)
+    && h.magic == id.magic && h.filesize == id.filesize && h.cluster == id.cluster
+    && h.date == id.date && h.time == id.time
+    && h.line_count <= SD_INDEX_SIZE && h.layer_count <= SD_INDEX_SIZE
+    && f.read(line_pos, h.line_count * sizeof(uint32_t)) == int16_t(h.line_count * sizeof(uint32_t))
+    && f.read(layer_pos, h.layer_count * sizeof(uint32_t)) == int16_t(h.layer_count * sizeof(uint32_t));
+  f.close();
+
+  if (ok) header = h; else header.magic = 0;
+  return ok;
+}
+
+bool SDIndex::save() {
+  #if ENABLED(SDCARD_READONLY)
+    return false;
+  #else
+    if (!is_current()) return false;
+
+    char name[14];
+    sidecar_name(name);
+    SdFile f;
+    if (!f.open(&card.root, name, O_CREAT | O_WRITE | O_TRUNC)) return false;
+
+    const bool ok = f.write(&header, sizeof(header)) == sizeof(header)
+      && f.write(line_pos, header.line_count * sizeof(uint32_t)) == int16_t(header.line_count * sizeof(uint32_t))
+      && f.write(layer_pos, header.layer_count * sizeof(uint32_t)) == int16_t(header.layer_count * sizeof(uint32_t));
+    return f.close() && ok;
+  #endif
+}
+
+/**
+ * Read to the start of the next line.
+ * Return true if the line starts with SD_INDEX_LAYER_MARKER.
+ */
+bool SDIndex::read_line() {
+  static constexpr char marker[] = SD_INDEX_LAYER_MARKER;
+  uint8_t m = 0;
+  while (!card.eof()) {
+    const int16_t c = card.get();
+    if (c < 0 || c == '\n') break;
+    if (m < COUNT(marker) - 1) m = (c == marker[m]) ? m + 1 : COUNT(marker);
+  }
+  return m == COUNT(marker) - 1;
+}
+
+// Add a position to a table, doubling its stride when it's full
+static void add_entry(uint32_t * const table, uint16_t &count, uint32_t &stride, const uint32_t n, const uint32_t pos) {
+  if (n % stride) return;
+  if (count == SD_INDEX_SIZE) {
+    for (uint16_t i = 0; i < SD_INDEX_SIZE / 2; ++i) table[i] = table[i * 2];
+    count = SD_INDEX_SIZE / 2;
+    stride *= 2;
+    if (n % stride) return;
+  }
+  table[count++] = pos;
+}
+
+bool SDIndex::build() {
+  sd_index_header_t h;
+  if (card.isPrinting() || !get_identity(h)) return false;
+
+  h.lines = h.layers = 0;
+  h.line_stride = h.layer_stride = 1;
+  h.line_count = h.layer_count = 0;
+  header.magic = 0;
+
+  const uint32_t old_pos = card.getIndex();
+  card.setIndex(0);
+
+  millis_t next_idle_ms = millis() + 200UL;
+  while (!card.eof()) {
+    const uint32_t pos = card.getIndex();
+    add_entry(line_pos, h.line_count, h.line_stride, h.lines++, pos);
+    if (read_line()) add_entry(layer_pos, h.layer_count, h.layer_stride, h.layers++, pos);
+
+    const millis_t ms = millis();
+    if (ELAPSED(ms, next_idle_ms)) {
+      next_idle_ms = ms + 200UL;
+      idle();
+      if (!card.isFileOpen()) return false;   // Media removed
+    }
+  }
+
+  card.setIndex(old_pos);
+  header = h;
+  return true;
+}
+
+/**
+ * Set the SD position to the start of the given line or layer (as 0-based n),
+ * reading forward from the nearest table entry.
+ */
+bool SDIndex::seek(const uint32_t * const table, const uint16_t count, const uint32_t stride, const uint32_t target, const bool layers) {
+  if (!count) return false;
+  const uint16_t i = _MIN(target / stride, count - 1U);
+  uint32_t n = i * stride;
+  card.setIndex(table[i]);
+
+  if (!layers) {
+    for (; n < target; n++) {
+      if (card.eof()) return false;
+      read_line();
+    }
+    return true;
+  }
+
+  // The entry is the marker line of layer n
+  while (!card.eof()) {
+    const uint32_t pos = card.getIndex();
+    if (read_line()) {
+      if (n == target) { card.setIndex(pos); return true; }
+      n++;
+    }
+  }
+  return false;
+}
+
+bool SDIndex::seek_line(const uint32_t line) {
+  if (!is_current() || !WITHIN(line, 1, header.lines)) return false;
+  return seek(line_pos, header.line_count, header.line_stride, line - 1, false);
+}
+
+bool SDIndex::seek_layer(const uint32_t layer) {
+  if (!is_current() || layer >= header.layers) return false;
+  return seek(layer_pos, header.layer_count, header.layer_stride, layer, true);
+}
+
+void SDIndex::report() {
+  if (!is_current()) { SERIAL_ECHOLNPGM("No index for the selected file"); return; }
+  SERIAL_ECHOLNPGM(
+    "Index lines:", header.lines, " layers:", header.layers,
+    " line_stride:", header.line_stride, " layer_stride:", header.layer_stride
+  );
+}
+
+#endif // SD_LINE_INDEX
@@ -0,0 +1,73 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/sd_index.h - Line and layer index of the selected SD file
+ *
+ * A sparse table of file positions for every Nth line and every Nth layer,
+ * where N doubles whenever a table fills up. Seeking looks up the nearest
+ * entry at or before the target, then reads forward at most N lines.
+ *
+ * The index is saved as a sidecar file in the root folder, named for the
+ * file's first cluster, and is only used while the file size, first cluster
+ * and modification time still match.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+typedef struct {
+  uint32_t magic,
+           filesize,            // Identity of the indexed file
+           cluster;
+  uint16_t date, time;
+  uint32_t lines, layers,       // Totals found in the file
+           line_stride,         // Lines between line table entries
+           layer_stride;        // Layers between layer table entries
+  uint16_t line_count,          // Entries used in each table
+           layer_count;
+} sd_index_header_t;
+
+class SDIndex {
+public:
+  static bool is_current();         // Is the index for the selected file?
+  static bool load();               // Load the sidecar for the selected file
+  static bool build();              // Scan the selected file. Blocks until done.
+  static bool save();               // Write the sidecar for the selected file
+
+  // Set the SD position to the start of a line (1-based) or a layer (0-based)
+  static bool seek_line(const uint32_t line);
+  static bool seek_layer(const uint32_t layer);
+
+  static void report();
+
+private:
+  static sd_index_header_t header;
+  static uint32_t line_pos[SD_INDEX_SIZE], layer_pos[SD_INDEX_SIZE];
+
+  static bool get_identity(sd_index_header_t &id);
+  static void sidecar_name(char * const name);
+  static bool read_line();
+  static bool seek(const uint32_t * const table, const uint16_t count, const uint32_t stride, const uint32_t target, const bool layers);
+};
+
+extern SDIndex sd_index;
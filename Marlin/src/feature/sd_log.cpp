@@ -0,0 +1,249 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_LOG)
+
+#include "sd_log.h"
+#include "../sd/cardreader.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+#include "../MarlinCore.h"
+
+#define SD_LOG_VERSION 1
+#define SD_LOG_HEATERS (HOTENDS + ENABLED(HAS_HEATED_BED) + ENABLED(HAS_TEMP_CHAMBER))
+
+SDLog sd_log;
+
+static SdFile log_file;
+
+volatile bool SDLog::logging; // = false
+uint8_t SDLog::buffer[2][512] __attribute__((aligned(4)));
+uint16_t SDLog::limit[2], SDLog::used;
+uint8_t SDLog::active;
+bool SDLog::full[2];
+uint16_t SDLog::dropped, SDLog::blocks_since_sync;
+millis_t SDLog::next_sample_ms;
+
+SDLog::valve_event_t SDLog::valve_events[8];
+volatile uint8_t SDLog::valve_head, SDLog::valve_overruns;
+uint8_t SDLog::valve_tail, SDLog::valve_overruns_seen;
+bool SDLog::valve_open;
+
+/**
+ * Open (or append to) the log file and start logging.
+ * The first buffer only fills to the end of the file's last block,
+ * so every later write is a whole, aligned block.
+ */
+bool SDLog::start(const char * const path) {
+  stop();
+  if (!card.isMounted()) return false;
+
+  SdFile *dir;
+  const char * const fname = card.diveToFile(false, dir, path);
+  if (!fname || !log_file.open(dir, fname, O_CREAT | O_APPEND | O_WRITE)) return false;
+
+  limit[0] = 512 - (log_file.fileSize() & 0x1FF);
+  limit[1] = 512;
+  used = active = 0;
+  full[0] = full[1] = false;
+  dropped = blocks_since_sync = 0;
+  valve_tail = valve_head;
+  valve_overruns_seen = valve_overruns;
+  valve_open = false;
+  logging = true;
+
+  const struct __attribute__((__packed__)) {
+    uint8_t version, hotends, bed, chamber, axes, extruder;
+    uint16_t interval;
+  } info = {
+    SD_LOG_VERSION, HOTENDS, ENABLED(HAS_HEATED_BED), ENABLED(HAS_TEMP_CHAMBER), NUM_AXES, ENABLED(HAS_EXTRUDERS), SD_LOG_INTERVAL
+  };
+  const millis_t ms = millis();
+  append(SD_LOG_START, ms, &info, sizeof(info));
+  next_sample_ms = ms;
+  return true;
+}
+
+// Log the last events, write the part-filled buffer and close the file
+void SDLog::stop() {
+  if (!logging) return;
+
+  drain_valve_events(millis(), true);
+  append(SD_LOG_STOP, millis(), &dropped, sizeof(dropped));
+  logging = false;
+
+  LOOP_L_N(i, 2) {
+    const uint8_t b = active ^ 1 ^ i;
+    if (full[b] && !write_block(b)) return;
+  }
+  if (used && used < limit[active]) log_file.write(buffer[active], used);
+  log_file.close();
+}
+
+void SDLog::fail() {
+  logging = false;
+  log_file.close();
+  SERIAL_ERROR_MSG("SD log write failed");
+}
+
+void SDLog::note(const uint16_t code, const float value) {
+  const struct __attribute__((__packed__)) { uint16_t code; float value; } n = { code, value };
+  append(SD_LOG_NOTE, millis(), &n, sizeof(n));
+}
+
+/**
+ * Add a record to the buffers. The record is dropped if there isn't room for all
+ * of it, which only happens if blocks can't be written as fast as records come in.
+ */
+bool SDLog::append(const SDLogRecord type, const uint32_t ms, const void * const data, const uint8_t size) {
+  if (!logging) return false;
+  const sd_log_header_t h = { type, uint8_t(sizeof(h) + size), ms };
+  const uint16_t room = (full[active] ? 0 : limit[active] - used) + (full[active ^ 1] ? 0 : 512);
+  if (h.size > room) { dropped++; return false; }
+  put(&h, sizeof(h));
+  put(data, size);
+  return true;
+}
+
+// Copy to the active buffer, moving on to the other buffer when it fills
+void SDLog::put(const void * const data, uint8_t size) {
+  const uint8_t *src = (const uint8_t*)data;
+  while (size) {
+    if (used == limit[active]) {
+      active ^= 1;
+      limit[active] = 512;
+      used = 0;
+    }
+    const uint8_t n = _MIN(size, limit[active] - used);
+    memcpy(&buffer[active][used], src, n);
+    used += n;
+    src += n;
+    size -= n;
+    if (used == limit[active]) full[active] = true;
+  }
+}
+
+bool SDLog::write_block(const uint8_t b) {
+  if (log_file.write(buffer[b], limit[b]) != int16_t(limit[b])) { fail(); return false; }
+  full[b] = false;
+  blocks_since_sync++;
+  return true;
+}
+
+void SDLog::sample() {
+  struct __attribute__((__packed__)) {
+    int16_t temp[SD_LOG_HEATERS][2];
+    float pos[LOGICAL_AXES];
+    uint8_t flags;
+  } s;
+
+  uint8_t i = 0;
+  HOTEND_LOOP() {
+    s.temp[i][0] = thermalManager.degHotend(e) * 10;
+    s.temp[i++][1] = thermalManager.degTargetHotend(e);
+  }
+  #if HAS_HEATED_BED
+    s.temp[i][0] = thermalManager.degBed() * 10;
+    s.temp[i++][1] = thermalManager.degTargetBed();
+  #endif
+  #if HAS_TEMP_CHAMBER
+    s.temp[i][0] = thermalManager.degChamber() * 10;
+    s.temp[i][1] = TERN0(HAS_HEATED_CHAMBER, thermalManager.degTargetChamber());
+  #endif
+  UNUSED(i);
+
+  const abce_pos_t pos = planner.get_axis_positions_mm();
+  LOOP_LOGICAL_AXES(a) s.pos[a] = pos[a];
+
+  // Bit 0: Valve open, 1: Print job running, 2: Paused
+  s.flags = (valve_open ? _BV(0) : 0) | (printJobOngoing() ? _BV(1) : 0) | (printingIsPaused() ? _BV(2) : 0);
+
+  append(SD_LOG_SAMPLE, millis(), &s, sizeof(s));
+}
+
+/**
+ * Log valve events from the Stepper ISR. The valve closes at the end of each
+ * block and opens again at the start of the next, so a close followed at once
+ * by an open is left out. Unless forced, a close is held back a moment to see.
+ */
+void SDLog::drain_valve_events(const millis_t ms, const bool force/*=false*/) {
+  while (valve_tail != valve_head) {
+    const valve_event_t &ev = valve_events[valve_tail];
+    const uint8_t next = (valve_tail + 1) % COUNT(valve_events);
+    if (!ev.open) {
+      if (next == valve_head) {
+        if (!force && ms - ev.ms < 2) break;
+      }
+      else if (valve_events[next].open && valve_events[next].ms - ev.ms < 2) {
+        valve_tail = (next + 1) % COUNT(valve_events);
+        continue;
+      }
+    }
+    if (ev.open != valve_open) {
+      valve_open = ev.open;
+      const uint8_t open = valve_open;
+      append(SD_LOG_VALVE, ev.ms, &open, sizeof(open));
+    }
+    valve_tail = next;
+  }
+
+  const uint8_t overruns = valve_overruns;
+  dropped += uint8_t(overruns - valve_overruns_seen);
+  valve_overruns_seen = overruns;
+}
+
+/**
+ * Take samples and write full buffers, oldest first.
+ * Update the file size in the directory every SD_LOG_SYNC_BLOCKS blocks.
+ */
+void SDLog::idle() {
+  if (!logging) return;
+
+  const millis_t ms = millis();
+  drain_valve_events(ms);
+
+  if (ELAPSED(ms, next_sample_ms)) {
+    next_sample_ms = ms + SD_LOG_INTERVAL;
+    sample();
+  }
+
+  LOOP_L_N(i, 2) {
+    const uint8_t b = active ^ 1 ^ i;
+    if (full[b] && !write_block(b)) return;
+  }
+
+  if (blocks_since_sync >= SD_LOG_SYNC_BLOCKS) {
+    blocks_since_sync = 0;
+    if (!log_file.sync()) fail();
+  }
+}
+
+void SDLog::report() {
+  if (logging)
+    SERIAL_ECHOLNPGM("SD log on. Dropped records: ", dropped);
+  else
+    SERIAL_ECHOLNPGM("SD log off");
+}
+
+#endif // SD_LOG
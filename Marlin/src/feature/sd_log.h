@@ -0,0 +1,97 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/sd_log.h - Binary telemetry log on the SD card
+ *
+ * Records go into one of two block-sized RAM buffers. When a buffer fills
+ * it's written to the log file as a whole block from idle(), while new
+ * records go into the other buffer. All media access happens in the main
+ * loop, so the log and the file being printed share the volume cache and
+ * no buffer is ever read back.
+ *
+ * Records are little-endian, each starting with sd_log_header_t.
+ * See buildroot/share/scripts/sd_log_dump.py for a reader.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+enum SDLogRecord : uint8_t {
+  SD_LOG_START = 1,   // uint8 version, hotends, bed, chamber, axes, extruder; uint16 interval
+  SD_LOG_SAMPLE,      // int16 temp (0.1°C) and int16 target (°C) for each heater, float position (mm) per logical axis, uint8 flags
+  SD_LOG_VALVE,       // uint8 open
+  SD_LOG_NOTE,        // uint16 code, float value
+  SD_LOG_STOP         // uint16 records dropped
+};
+
+typedef struct __attribute__((__packed__)) {
+  uint8_t type, size;   // Size of the whole record
+  uint32_t ms;
+} sd_log_header_t;
+
+class SDLog {
+public:
+  static bool start(const char * const path);
+  static void stop();
+  static bool is_logging() { return logging; }
+
+  // Add a note record, e.g., a pressure reported by the host
+  static void note(const uint16_t code, const float value);
+
+  // Called from the Stepper ISR when the pneumatic valve opens or closes
+  static void valve_changed(const bool open) {
+    if (!logging) return;
+    const uint8_t h = valve_head, n = (h + 1) % COUNT(valve_events);
+    if (n == valve_tail) { valve_overruns++; return; }   // Only the ISR changes this
+    valve_events[h] = { millis(), open };
+    valve_head = n;
+  }
+
+  static void idle();
+  static void report();
+
+private:
+  typedef struct { uint32_t ms; bool open; } valve_event_t;
+
+  static volatile bool logging;
+  static uint8_t buffer[2][512];
+  static uint16_t limit[2], used;       // Bytes each buffer holds when full, bytes used in the active buffer
+  static uint8_t active;
+  static bool full[2];                  // Waiting to be written
+  static uint16_t dropped, blocks_since_sync;
+  static millis_t next_sample_ms;
+
+  static valve_event_t valve_events[8];
+  static volatile uint8_t valve_head, valve_overruns;
+  static uint8_t valve_tail, valve_overruns_seen;
+  static bool valve_open;
+
+  static bool append(const SDLogRecord type, const uint32_t ms, const void * const data, const uint8_t size);
+  static void put(const void * const data, uint8_t size);
+  static bool write_block(const uint8_t b);
+  static void fail();
+  static void sample();
+  static void drain_valve_events(const millis_t ms, const bool force=false);
+};
+
+extern SDLog sd_log;
@@ -0,0 +1,123 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SYRINGE_MONITOR)
+
+#include "syringe_monitor.h"
+#include "tmc_util.h"
+#include "../module/stepper/indirection.h"
+#include "../gcode/queue.h"
+#include "../lcd/marlinui.h"
+#include "../MarlinCore.h"
+
+#if ENABLED(HOST_ACTION_COMMANDS)
+  #include "host_actions.h"
+#endif
+
+SyringeMonitor syringe_monitor;
+
+bool SyringeMonitor::enabled = true,
+     SyringeMonitor::stream, // = false
+     SyringeMonitor::tripped, // = false
+     SyringeMonitor::trip_clog; // = false
+uint8_t SyringeMonitor::clog_percent = SYRINGE_MONITOR_CLOG,
+        SyringeMonitor::empty_percent = SYRINGE_MONITOR_EMPTY,
+        SyringeMonitor::learned; // = 0
+millis_t SyringeMonitor::next_ms, // = 0
+         SyringeMonitor::trip_ms; // = 0
+uint32_t SyringeMonitor::tstep; // = 0
+float SyringeMonitor::baseline; // = 0
+
+void SyringeMonitor::update() {
+  const millis_t ms = millis();
+  if (PENDING(ms, next_ms)) return;
+  next_ms = ms + SYRINGE_MONITOR_INTERVAL_MS;
+  if (!enabled && !stream) return;
+
+  // Standstill, or no driver to read. Start again on the next move.
+  constexpr uint32_t CS_ACTUAL_bm = 0x1F0000; // 16:20
+  constexpr uint8_t CS_ACTUAL_sb = 16, STST_bp = 31;
+  const uint32_t ds = stepperE0.DRV_STATUS();
+  if (TEST(ds, STST_bp) || ds == 0xFFFFFFFF) { reset(); return; }
+
+  const uint16_t sg = stepperE0.SG_RESULT();
+  const uint32_t ts = stepperE0.TSTEP();
+  if (!ts) return; // Failed read
+
+  if (stream)
+    SERIAL_ECHOLNPGM("SG:", sg, " CS:", (ds & CS_ACTUAL_bm) >> CS_ACTUAL_sb, " TSTEP:", ts, " B:", baseline);
+
+  // Learn again at a new speed, since SG_RESULT depends on it
+  if (learned && (ts > tstep + (tstep >> 2) || ts < tstep - (tstep >> 2))) { learned = 0; trip_ms = 0; }
+
+  if (learned < SYRINGE_MONITOR_LEARN) {
+    if (!learned) tstep = ts;
+    baseline += (sg - baseline) / ++learned;
+    return;
+  }
+
+  if (tripped) return;
+
+  const bool clog = sg < baseline * (100 - clog_percent) * 0.01f,
+             empty = sg > baseline * (100 + empty_percent) * 0.01f;
+  if (clog || empty) {
+    if (!trip_ms || clog != trip_clog) { trip_ms = ms; trip_clog = clog; }
+    else if (ELAPSED(ms, trip_ms + SYRINGE_MONITOR_TRIP_MS) && enabled && printingIsActive()) trip(clog, sg);
+  }
+  else {
+    trip_ms = 0;
+    baseline += (sg - baseline) * (1.0f / (1 << (SYRINGE_MONITOR_SHIFT)));
+  }
+}
+
+void SyringeMonitor::trip(const bool clog, const uint16_t sg) {
+  tripped = true;
+
+  SERIAL_ECHO_START();
+  SERIAL_ECHOF(clog ? F("Syringe clog") : F("Syringe empty"));
+  SERIAL_ECHOLNPGM(" SG:", sg, " B:", baseline);
+  ui.set_alert_status(clog ? F("Syringe clog") : F("Syringe empty"));
+
+  #if ENABLED(HOST_ACTION_COMMANDS)
+    hostui.pause(false);
+    SERIAL_ECHOLNF(clog ? F(" syringe_clog 0") : F(" syringe_empty 0"));
+  #endif
+
+  #ifdef SYRINGE_MONITOR_SCRIPT
+    queue.inject(F(SYRINGE_MONITOR_SCRIPT));
+  #endif
+}
+
+void SyringeMonitor::report() {
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPGM("Syringe monitor ");
+  serialprint_onoff(enabled);
+  SERIAL_ECHOPGM(" C", clog_percent, " A", empty_percent, " Stream ");
+  serialprint_onoff(stream);
+  if (learned >= SYRINGE_MONITOR_LEARN)
+    SERIAL_ECHOPGM(" Baseline ", baseline, " TSTEP ", tstep);
+  SERIAL_EOL();
+}
+
+#endif // SYRINGE_MONITOR
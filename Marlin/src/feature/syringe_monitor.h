@@ -0,0 +1,62 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/syringe_monitor.h - Watch the load on the E0 syringe through its TMC2209
+ *
+ * While E0 moves, its driver's StallGuard result (SG_RESULT) is sampled at a
+ * fixed rate and compared to a baseline. The baseline is learned over the first
+ * samples at each speed (TSTEP), then follows the good samples slowly. A result
+ * held below the baseline means more load (a clog) and one held above it means
+ * less load (air, or an empty syringe).
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class SyringeMonitor {
+public:
+  static bool enabled,          // Pause the print on a clog or empty syringe
+              stream;           // Print every sample
+  static uint8_t clog_percent,  // Drop below the baseline for a clog
+                 empty_percent; // Rise above the baseline for empty
+
+  // Called from idle()
+  static void update();
+
+  // Learn the baseline again
+  static void reset() { learned = 0; tripped = false; trip_ms = 0; }
+
+  static void report();
+
+private:
+  static millis_t next_ms, trip_ms;
+  static uint32_t tstep;        // Step time the baseline was learned at
+  static float baseline;
+  static uint8_t learned;       // Samples in the baseline, up to SYRINGE_MONITOR_LEARN
+  static bool tripped,          // Waiting for E0 to stop before checking again
+              trip_clog;        // Whether trip_ms is timing a clog or empty
+
+  static void trip(const bool clog, const uint16_t sg);
+};
+
+extern SyringeMonitor syringe_monitor;
@@ -0,0 +1,94 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SYRINGE_VOLUME)
+
+#include "syringe_volume.h"
+#include "../module/planner.h"
+#include "../gcode/gcode.h"
+#include "../lcd/marlinui.h"
+#include "../MarlinCore.h"
+
+#if ENABLED(HOST_PROMPT_SUPPORT)
+  #include "host_actions.h"
+#endif
+
+SyringeVolume syringe_volume;
+
+float SyringeVolume::diameter[EXTRUDERS],
+      SyringeVolume::capacity[EXTRUDERS],
+      SyringeVolume::volume[EXTRUDERS],
+      SyringeVolume::margin,
+      SyringeVolume::layer_z = -1;
+uint8_t SyringeVolume::warned; // = 0
+
+void SyringeVolume::reset() {
+  constexpr float dia[] = SYRINGE_DIAMETER, cap[] = SYRINGE_CAPACITY;
+  static_assert(COUNT(dia) >= EXTRUDERS, "SYRINGE_DIAMETER needs a value for each extruder.");
+  static_assert(COUNT(cap) >= EXTRUDERS, "SYRINGE_CAPACITY needs a value for each extruder.");
+  EXTRUDER_LOOP() { diameter[e] = dia[e]; capacity[e] = cap[e]; }
+  margin = SYRINGE_REFILL_MARGIN;
+}
+
+void SyringeVolume::check_extrude(const float z) {
+  const uint8_t e = active_extruder;
+  const bool new_layer = ABS(z - layer_z) > 0.001f;
+  if (new_layer) layer_z = z;
+
+  if (volume[e] <= 0 || (new_layer && volume[e] < margin))
+    refill(e);
+  else if (volume[e] < margin && !TEST(warned, e)) {
+    SBI(warned, e);
+    SERIAL_ECHO_MSG("Syringe T", e, " low (", volume[e], "uL). Refill at the next layer.");
+  }
+}
+
+void SyringeVolume::refill(const uint8_t e) {
+  planner.synchronize();
+  const xyze_pos_t resume_pos = current_position,
+                   resume_dest = destination;  // G28 clobbers the move being held up
+  SERIAL_ECHO_MSG("Syringe T", e, " refill (", volume[e], "uL left)");
+
+  // Out of the way of the print
+  do_z_clearance(_MIN(resume_pos.z + (SYRINGE_REFILL_Z_RAISE), Z_MAX_POS));
+
+  // Pull the E0 plunger back to its refill position
+  if (e == 0 && active_extruder == 0) gcode.process_subcommands_now(F("G28E"));
+
+  LCD_MESSAGE_F("Refill syringe");
+  TERN_(HOST_PROMPT_SUPPORT, hostui.prompt_do(PROMPT_USER_CONTINUE, F("Refill syringe"), FPSTR(CONTINUE_STR)));
+  TERN_(HAS_RESUME_CONTINUE, wait_for_user_response());
+  ui.reset_status();
+
+  volume[e] = capacity[e];
+  CBI(warned, e);
+
+  // Back where the print left off
+  current_position.e = resume_pos.e;
+  sync_plan_position_e();
+  do_blocking_move_to_z(resume_pos.z);
+  destination = resume_dest;
+}
+
+#endif // SYRINGE_VOLUME
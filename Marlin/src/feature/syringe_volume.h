@@ -0,0 +1,70 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/syringe_volume.h - Volume left in each syringe, with refills at layer changes
+ *
+ * The planner takes each move's extruder travel off the volume left in the
+ * active syringe, as plunger travel times the area of the bore. When it gets
+ * below the margin, the next extruding move at a new Z height (the start of a
+ * layer) stops for a refill first. An empty syringe stops for one right away.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../module/motion.h"
+
+class SyringeVolume {
+public:
+  static float diameter[EXTRUDERS],   // (mm) Syringe bore
+               capacity[EXTRUDERS],   // (µL) Volume when full, 0 to not track
+               volume[EXTRUDERS],     // (µL) Volume left
+               margin;                // (µL) Refill at the next layer below this
+
+  // Settings defaults
+  static void reset();
+
+  // Full syringes, as at startup
+  static void fill_all() { EXTRUDER_LOOP() volume[e] = capacity[e]; warned = 0; }
+
+  // Called by the planner with the extruder travel of each move. Retracts
+  // and the plunger homing back out never make it more than full.
+  static void consume(const uint8_t e, const float mm) {
+    if (capacity[e]) volume[e] = _MIN(volume[e] - mm * sq(diameter[e]) * float(M_PI / 4), capacity[e]);
+  }
+
+  // Called by G0/G1 before each move
+  static void check_move(const xyze_pos_t &dest) {
+    if (dest.e > current_position.e && capacity[active_extruder]) check_extrude(dest.z);
+  }
+
+  // Raise Z, home E0, wait for the operator, then put things back
+  static void refill(const uint8_t e);
+
+private:
+  static float layer_z;               // Z of the last extruding move
+  static uint8_t warned;              // Bits for syringes already reported low
+
+  static void check_extrude(const float z);
+};
+
+extern SyringeVolume syringe_volume;
@@ -0,0 +1,164 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TEMP_HISTORY)
+
+#include "temp_history.h"
+#include "../libs/crc16.h"
+
+#define TEMP_HISTORY_VERSION 1
+
+TempHistory temp_history;
+
+#define _HOTEND_ID(N) H_E##N,
+const heater_id_t TempHistory::channel_id[TEMP_HISTORY_CHANNELS] = {
+  REPEAT(HOTENDS, _HOTEND_ID)
+  #if HAS_HEATED_BED
+    H_BED,
+  #endif
+  #if HAS_TEMP_PROBE
+    H_PROBE,
+  #endif
+  #if HAS_TEMP_CHAMBER
+    H_CHAMBER,
+  #endif
+  #if HAS_TEMP_COOLER
+    H_COOLER,
+  #endif
+  #if HAS_TEMP_BOARD
+    H_BOARD,
+  #endif
+  #if HAS_TEMP_REDUNDANT
+    H_REDUNDANT,
+  #endif
+};
+
+temp_history_sample_t TempHistory::samples[TEMP_HISTORY_SAMPLES];
+uint16_t TempHistory::head, TempHistory::used;
+TempHistory::channel_acc_t TempHistory::acc[TEMP_HISTORY_CHANNELS];
+uint16_t TempHistory::acc_count;
+millis_t TempHistory::next_ms;
+
+static bool has_heater(const heater_id_t id) {
+  switch (id) {
+    case H_BED:     return ENABLED(HAS_HEATED_BED);
+    case H_CHAMBER: return ENABLED(HAS_HEATED_CHAMBER);
+    case H_COOLER:  return ENABLED(HAS_COOLER);
+    default:        return id >= 0;
+  }
+}
+
+static celsius_float_t channel_celsius(const heater_id_t id) {
+  switch (id) {
+    #if HAS_HEATED_BED
+      case H_BED: return thermalManager.degBed();
+    #endif
+    #if HAS_TEMP_PROBE
+      case H_PROBE: return thermalManager.degProbe();
+    #endif
+    #if HAS_TEMP_CHAMBER
+      case H_CHAMBER: return thermalManager.degChamber();
+    #endif
+    #if HAS_TEMP_COOLER
+      case H_COOLER: return thermalManager.degCooler();
+    #endif
+    #if HAS_TEMP_BOARD
+      case H_BOARD: return thermalManager.degBoard();
+    #endif
+    #if HAS_TEMP_REDUNDANT
+      case H_REDUNDANT: return thermalManager.degRedundant();
+    #endif
+    default: return thermalManager.degHotend(id);
+  }
+}
+
+void TempHistory::clear() {
+  head = used = acc_count = 0;
+  next_ms = millis() + SEC_TO_MS(TEMP_HISTORY_INTERVAL);
+}
+
+void TempHistory::sample() {
+  if (!next_ms) clear();
+
+  LOOP_L_N(c, TEMP_HISTORY_CHANNELS) {
+    const heater_id_t id = channel_id[c];
+    const int16_t t = LROUND(channel_celsius(id) * 10);
+    const uint8_t p = has_heater(id) ? thermalManager.getHeaterPower(id) : 0;
+    channel_acc_t &a = acc[c];
+    if (acc_count) {
+      a.sum += t; a.power += p;
+      NOMORE(a.low, t); NOLESS(a.high, t);
+    }
+    else
+      a = { t, t, t, p };
+  }
+  acc_count++;
+
+  const millis_t ms = millis();
+  if (PENDING(ms, next_ms)) return;
+  next_ms += SEC_TO_MS(TEMP_HISTORY_INTERVAL);
+
+  temp_history_sample_t &s = samples[head];
+  s.ms = ms;
+  LOOP_L_N(c, TEMP_HISTORY_CHANNELS) {
+    const channel_acc_t &a = acc[c];
+    // soft_pwm_amount is 0-127
+    s.value[c] = { int16_t(a.sum / acc_count), a.low, a.high, uint8_t(_MIN(a.power * 2 / acc_count, 255U)) };
+  }
+  acc_count = 0;
+
+  head = (head + 1) % (TEMP_HISTORY_SAMPLES);
+  if (used < TEMP_HISTORY_SAMPLES) used++;
+}
+
+static void put(const void * const data, const uint16_t size, uint16_t &crc) {
+  const uint8_t *b = (const uint8_t*)data;
+  LOOP_L_N(i, size) SERIAL_CHAR(char(b[i]));
+  crc16(&crc, data, size);
+}
+
+void TempHistory::dump(uint16_t n) {
+  NOMORE(n, used);
+
+  const struct __attribute__((__packed__)) {
+    uint8_t version, channels;
+    uint16_t interval, samples;
+    uint32_t now;
+  } info = { TEMP_HISTORY_VERSION, TEMP_HISTORY_CHANNELS, TEMP_HISTORY_INTERVAL, n, millis() };
+
+  const uint16_t size = sizeof(info) + (TEMP_HISTORY_CHANNELS) * 2 + n * sizeof(temp_history_sample_t) + 2;
+  SERIAL_ECHOLNPGM("TEMP_HISTORY:", size);
+
+  uint16_t crc = 0;
+  put(&info, sizeof(info), crc);
+  LOOP_L_N(c, TEMP_HISTORY_CHANNELS) {
+    const uint8_t ch[2] = { uint8_t(channel_id[c]), has_heater(channel_id[c]) };
+    put(ch, 2, crc);
+  }
+  for (uint16_t i = used - n; i < used; ++i) put(&get(i), sizeof(temp_history_sample_t), crc);
+  SERIAL_CHAR(char(crc & 0xFF), char(crc >> 8));
+  SERIAL_EOL();
+}
+
+#endif // TEMP_HISTORY
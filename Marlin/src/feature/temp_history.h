@@ -0,0 +1,89 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/temp_history.h - Temperature history in RAM
+ *
+ * Every sensor reading is folded into the current sample, which keeps the
+ * mean, lowest and highest temperature and the mean heater power. At the
+ * end of each interval the sample goes into a ring buffer, overwriting the
+ * oldest one when the buffer is full.
+ *
+ * M746 sends the buffer to the host as one binary frame, little-endian:
+ *
+ *   uint8 version, channels; uint16 interval (s), samples; uint32 now (ms)
+ *   For each channel: int8 heater_id_t, uint8 has heater
+ *   For each sample, oldest first: uint32 time (ms) at the end of the
+ *     interval, then for each channel temp_history_value_t
+ *   uint16 CRC16 of all the above
+ *
+ * See buildroot/share/scripts/temp_history_dump.py for a reader.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../module/temperature.h"
+
+#define TEMP_HISTORY_CHANNELS (HOTENDS + ENABLED(HAS_HEATED_BED) + ENABLED(HAS_TEMP_PROBE) + ENABLED(HAS_TEMP_CHAMBER) \
+                             + ENABLED(HAS_TEMP_COOLER) + ENABLED(HAS_TEMP_BOARD) + ENABLED(HAS_TEMP_REDUNDANT))
+
+typedef struct __attribute__((__packed__)) {
+  int16_t mean, low, high;  // 0.1°C
+  uint8_t power;            // Mean heater power, 0-255
+} temp_history_value_t;
+
+typedef struct __attribute__((__packed__)) {
+  uint32_t ms;
+  temp_history_value_t value[TEMP_HISTORY_CHANNELS];
+} temp_history_sample_t;
+
+class TempHistory {
+public:
+  static const heater_id_t channel_id[TEMP_HISTORY_CHANNELS];
+
+  static void clear();
+
+  // Called by Temperature::manage_heater with each new set of readings
+  static void sample();
+
+  static uint16_t count() { return used; }
+
+  // A stored sample, 0 being the oldest
+  static const temp_history_sample_t& get(const uint16_t i) {
+    return samples[(head + TEMP_HISTORY_SAMPLES - used + i) % (TEMP_HISTORY_SAMPLES)];
+  }
+
+  // Send the newest 'n' samples to the host as a binary frame
+  static void dump(uint16_t n);
+
+private:
+  typedef struct { int32_t sum; int16_t low, high; uint32_t power; } channel_acc_t;
+
+  static temp_history_sample_t samples[TEMP_HISTORY_SAMPLES];
+  static uint16_t head, used;
+
+  static channel_acc_t acc[TEMP_HISTORY_CHANNELS];
+  static uint16_t acc_count;
+  static millis_t next_ms;
+};
+
+extern TempHistory temp_history;
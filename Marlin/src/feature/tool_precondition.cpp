@@ -0,0 +1,237 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TOOLCHANGE_PRECONDITION)
+
+#include "tool_precondition.h"
+#include "../module/temperature.h"
+#include "../module/motion.h"
+#include "../gcode/queue.h"
+
+#if HAS_PACKED_COMMANDS
+  #include "packed_gcode.h"
+#endif
+
+#if ENABLED(SD_READ_AHEAD)
+  #include "../sd/cardreader.h"
+#endif
+
+ToolPrecondition tool_precondition;
+
+#if ENABLED(SD_READ_AHEAD)
+  bool ToolPrecondition::printing; // = false
+  int8_t ToolPrecondition::scan_tool, ToolPrecondition::next_tool = -1;
+  celsius_t ToolPrecondition::next_target;
+  uint32_t ToolPrecondition::next_pos, ToolPrecondition::scan_pos, ToolPrecondition::rate_pos;
+  float ToolPrecondition::read_rate;
+  millis_t ToolPrecondition::next_rate_ms;
+#endif
+
+// Read an integer, ignoring any fraction
+static bool get_int(const char* &p, const char * const end, int &v) {
+  const bool neg = p < end && *p == '-';
+  if (neg) ++p;
+  if (p >= end || !NUMERIC(*p)) return false;
+  v = 0;
+  while (p < end && NUMERIC(*p)) v = v * 10 + (*p++ - '0');
+  if (neg) v = -v;
+  return true;
+}
+
+// Get a parameter of a command, ignoring comments
+static bool get_param(const char *p, const char * const end, const char code, int &v) {
+  for (; p < end && *p != ';' && *p != '('; ++p)
+    if (*p == code) { ++p; return get_int(p, end, v); }
+  return false;
+}
+
+// Get the command word and the T, S and R values of a line of text
+static bool parse_text(const char *p, const char * const end, scanned_command_t &c) {
+  while (p < end && *p == ' ') ++p;
+  if (p < end && *p == 'N') {                 // Skip a line number
+    do ++p; while (p < end && NUMERIC(*p));
+    while (p < end && *p == ' ') ++p;
+  }
+  if (p >= end) return false;
+  c.letter = *p++;
+  if (!get_int(p, end, c.code)) return false;
+  c.has_t = get_param(p, end, 'T', c.t);
+  c.has_s = get_param(p, end, 'S', c.s);
+  c.has_r = get_param(p, end, 'R', c.r);
+  return true;
+}
+
+#if HAS_PACKED_COMMANDS
+
+  // Get a value stored after the command word by PackedGCode::store
+  static bool packed_value(const char * const buffer, const packed_gcode_t &h, const char code, int &v) {
+    const uint8_t b = code - 'A';
+    if (!TEST32(h.valbits, b)) return false;
+    const char *p = buffer + strlen(buffer) + 1 + sizeof(h);
+    LOOP_L_N(i, b) if (TEST32(h.valbits, i)) p += sizeof(float);
+    float f;
+    memcpy(&f, p, sizeof(f));
+    v = int(f);
+    return true;
+  }
+
+  // Get the command word and the T, S and R values of a packed command
+  static bool parse_packed(const char * const buffer, scanned_command_t &c) {
+    packed_gcode_t h;
+    memcpy(&h, buffer + strlen(buffer) + 1, sizeof(h));
+    c.letter = h.letter;
+    c.code = h.codenum;
+    c.has_t = packed_value(buffer, h, 'T', c.t);
+    c.has_s = packed_value(buffer, h, 'S', c.s);
+    c.has_r = packed_value(buffer, h, 'R', c.r);
+    return true;
+  }
+
+#endif
+
+/**
+ * Follow one command. A "T<n>" for a different tool makes it the pending
+ * tool and a following M104 or M109 for that tool gives its target.
+ * Return true when the target of the pending tool is known.
+ */
+bool ToolPrecondition::follow(const scanned_command_t &c, int8_t &tool, int8_t &pending, celsius_t &target) {
+  if (c.letter == 'T') {
+    if (WITHIN(c.code, 0, HOTENDS - 1) && c.code != tool) { tool = pending = c.code; target = 0; }
+    return false;
+  }
+
+  if (c.letter == 'M' && (c.code == 104 || c.code == 109) && pending >= 0) {
+    const int e = c.has_t ? c.t : tool;       // No T means the active tool
+    const bool has_temp = c.has_s || (c.code == 109 && c.has_r);
+    if (e == pending && has_temp) {
+      const int t = c.has_s ? c.s : c.r;
+      if (t > 0) { target = t; return true; }
+      pending = -1;                           // Turned off, so nothing to do
+    }
+  }
+  return false;
+}
+
+void ToolPrecondition::apply(const int8_t e, const celsius_t target) {
+  if (e == active_extruder || thermalManager.degTargetHotend(e) == target) return;
+  thermalManager.setTargetHotend(target, e);
+  SERIAL_ECHO_MSG("Preconditioning T", e, " to ", target);
+}
+
+// Commands in the queue run soon, so their targets apply now
+void ToolPrecondition::scan_queue() {
+  int8_t tool = active_extruder, pending = -1;
+  celsius_t target = 0;
+  uint8_t r = queue.ring_buffer.index_r;
+  LOOP_L_N(i, queue.ring_buffer.length) {
+    const GCodeQueue::CommandLine &cmd = queue.ring_buffer.commands[r];
+    scanned_command_t c;
+    #if HAS_PACKED_COMMANDS
+      const bool ok = cmd.packed ? parse_packed(cmd.buffer, c) : parse_text(cmd.buffer, cmd.buffer + strlen(cmd.buffer), c);
+    #else
+      const bool ok = parse_text(cmd.buffer, cmd.buffer + strlen(cmd.buffer), c);
+    #endif
+    if (ok && follow(c, tool, pending, target)) {
+      apply(pending, target);
+      pending = -1;
+    }
+    if (++r >= BUFSIZE) r = 0;
+  }
+}
+
+#if ENABLED(SD_READ_AHEAD)
+
+  void ToolPrecondition::scan_file() {
+    if (!card.isPrinting()) { printing = false; return; }
+
+    const uint32_t sdpos = card.getIndex();
+    const millis_t ms = millis();
+
+    // Start over with a new print or after a pause
+    if (!printing || sdpos < rate_pos) {
+      printing = true;
+      scan_tool = active_extruder;
+      next_tool = -1;
+      scan_pos = rate_pos = sdpos;
+      read_rate = 0;
+      next_rate_ms = ms + 1000UL;
+    }
+
+    // Average the rate the print reads the file
+    if (ELAPSED(ms, next_rate_ms)) {
+      read_rate += (float(sdpos - rate_pos) - read_rate) * 0.25f;
+      rate_pos = sdpos;
+      next_rate_ms = ms + 1000UL;
+    }
+
+    // Apply a known target once the tool-change is within its lead time
+    if (next_tool >= 0 && next_target) {
+      static constexpr float rates[] = TOOLCHANGE_PRECONDITION_RATES;
+      static_assert(COUNT(rates) >= HOTENDS, "TOOLCHANGE_PRECONDITION_RATES needs a value for each hotend.");
+      const float lead = ABS(next_target - thermalManager.degHotend(next_tool)) / rates[next_tool] + (TOOLCHANGE_PRECONDITION_MARGIN);
+      if (sdpos >= next_pos || read_rate * lead >= next_pos - sdpos) {
+        apply(next_tool, next_target);
+        next_tool = -1;
+      }
+      return;
+    }
+
+    // Scan the whole lines not yet scanned
+    const uint8_t *buf;
+    const uint16_t len = card.peekAhead(buf);
+    if (!len) return;
+    uint32_t i;
+    if (scan_pos < sdpos) {
+      // The print read past the scan, as with a line split over a refill.
+      // Skip the rest of that line, so its tail isn't taken for a command.
+      const char * const eol = (const char*)memchr(buf, '\n', len);
+      if (!eol) return;
+      i = eol - (const char*)buf + 1;
+      scan_pos = sdpos + i;
+    }
+    else
+      i = scan_pos - sdpos;
+    while (i < len) {
+      const char * const line = (const char*)buf + i,
+                 * const eol = (const char*)memchr(line, '\n', len - i);
+      if (!eol) break;
+      i = eol - (const char*)buf + 1;
+      const uint32_t line_pos = scan_pos;
+      scan_pos = sdpos + i;
+      const int8_t was_pending = next_tool;
+      scanned_command_t c;
+      const bool found = parse_text(line, eol, c) && follow(c, scan_tool, next_tool, next_target);
+      if (next_tool >= 0 && next_tool != was_pending) next_pos = line_pos;  // The tool-change
+      if (found) break;
+    }
+  }
+
+#endif // SD_READ_AHEAD
+
+void ToolPrecondition::update() {
+  scan_queue();
+  TERN_(SD_READ_AHEAD, scan_file());
+}
+
+#endif // TOOLCHANGE_PRECONDITION
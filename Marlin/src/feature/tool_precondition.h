@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/tool_precondition.h - Bring the next tool to temperature before its tool-change
+ *
+ * The commands in the queue and the unread part of the SD read-ahead buffer
+ * are scanned for a tool-change "T<n>" followed by the new tool's "M104" or
+ * "M109". That temperature is set early, once the time left before the
+ * tool-change gets down to the time the hotend needs to reach it.
+ *
+ * The time left is the distance to the tool-change in the file over the rate
+ * the print is reading the file. Commands already in the queue are due now.
+ * The look-ahead is one read-ahead buffer of lines at most, which is seldom
+ * as much time as a hotend needs, so the target is usually set as soon as
+ * it is found.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+typedef struct {
+  char letter;
+  int code, t, s, r;
+  bool has_t, has_s, has_r;
+} scanned_command_t;
+
+class ToolPrecondition {
+public:
+  // Called from idle()
+  static void update();
+
+private:
+  #if ENABLED(SD_READ_AHEAD)
+    static bool printing;
+    static int8_t scan_tool,    // Tool active at the scan position
+                  next_tool;    // Upcoming tool, -1 for none
+    static celsius_t next_target; // Its target, 0 until found
+    static uint32_t next_pos,   // File position of the upcoming tool-change
+                    scan_pos,   // File position scanned up to
+                    rate_pos;   // File position at the last rate update
+    static float read_rate;     // Bytes per second read by the print
+    static millis_t next_rate_ms;
+    static void scan_file();
+  #endif
+
+  static void scan_queue();
+  static bool follow(const scanned_command_t &c, int8_t &tool, int8_t &pending, celsius_t &target);
+  static void apply(const int8_t e, const celsius_t target);
+};
+
+extern ToolPrecondition tool_precondition;
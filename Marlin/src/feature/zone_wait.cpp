@@ -0,0 +1,193 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(MULTI_ZONE_WAIT)
+
+#include "zone_wait.h"
+#include "../module/temperature.h"
+#include "../gcode/gcode.h"
+#include "../lcd/marlinui.h"
+#include "../MarlinCore.h"
+
+#ifndef MIN_COOLING_SLOPE_DEG
+  #define MIN_COOLING_SLOPE_DEG 1.50
+#endif
+#ifndef MIN_COOLING_SLOPE_TIME
+  #define MIN_COOLING_SLOPE_TIME 60
+#endif
+
+ZoneWait zone_wait;
+
+zone_mask_t ZoneWait::zones; // = 0
+bool ZoneWait::wait_for_cooling; // = false
+ZoneWait::zone_t ZoneWait::zone[ZONE_COUNT];
+
+typedef struct { millis_t residency; float window, hysteresis; } zone_limits_t;
+
+static zone_limits_t zone_limits(const uint8_t i) {
+  #if HAS_HEATED_CHAMBER
+    if (i == ZONE_CHAMBER) return { SEC_TO_MS(TEMP_CHAMBER_RESIDENCY_TIME), TEMP_CHAMBER_WINDOW, TEMP_CHAMBER_HYSTERESIS };
+  #endif
+  #if HAS_HEATED_BED
+    if (i == ZONE_BED) return { SEC_TO_MS(TEMP_BED_RESIDENCY_TIME), TEMP_BED_WINDOW, TEMP_BED_HYSTERESIS };
+  #endif
+  UNUSED(i);
+  return { SEC_TO_MS(TEMP_RESIDENCY_TIME), TEMP_WINDOW, TEMP_HYSTERESIS };
+}
+
+static celsius_float_t zone_temp(const uint8_t i) {
+  #if HAS_HEATED_CHAMBER
+    if (i == ZONE_CHAMBER) return thermalManager.degChamber();
+  #endif
+  #if HAS_HEATED_BED
+    if (i == ZONE_BED) return thermalManager.degBed();
+  #endif
+  return thermalManager.degHotend(i);
+}
+
+static celsius_t zone_target(const uint8_t i) {
+  #if HAS_HEATED_CHAMBER
+    if (i == ZONE_CHAMBER) return thermalManager.degTargetChamber();
+  #endif
+  #if HAS_HEATED_BED
+    if (i == ZONE_BED) return thermalManager.degTargetBed();
+  #endif
+  return thermalManager.degTargetHotend(i);
+}
+
+// Peltier zones are driven down to their targets, so always wait for them
+static bool zone_can_cool(const uint8_t i) {
+  return false
+    || TERN0(PELTIER_CONTROL_E0, i == 0)
+    || TERN0(PELTIER_CONTROL_E1, i == 1)
+    || TERN0(PELTIER_CONTROL_BED, TERN0(HAS_HEATED_BED, i == ZONE_BED))
+  ;
+}
+
+void ZoneWait::start(const zone_mask_t mask, const bool cool/*=false*/) {
+  LOOP_L_N(i, ZONE_COUNT) if (!TEST(zones, i)) zone[i].target = -1; // Restart the timers of new zones
+  zones = mask & ZONES_ALL;
+  wait_for_cooling = cool;
+  update();
+}
+
+void ZoneWait::update_zone(const uint8_t i, const millis_t now) {
+  zone_t &z = zone[i];
+  const celsius_t target = zone_target(i);
+  const celsius_float_t temp = zone_temp(i);
+
+  // A new target restarts the timer
+  if (target != z.target) {
+    z.target = target;
+    z.settle_ms = 0;
+    z.cool_check_ms = 0;
+    z.cool_temp = temp;
+    z.settled = false;
+  }
+
+  // Heaters that are off have nothing to wait for
+  if (!target) { z.settled = true; return; }
+
+  const zone_limits_t lim = zone_limits(i);
+
+  // Like M109 S, a zone above its target only waits if asked to
+  if (temp > target + lim.window && !wait_for_cooling && !zone_can_cool(i)) {
+    z.settled = true;
+    return;
+  }
+
+  const celsius_float_t diff = ABS(temp - target);
+  if (!z.settle_ms) {
+    // Start the residency timer when the zone first gets into the window
+    if (diff < lim.window) z.settle_ms = now + lim.residency;
+  }
+  else if (diff > lim.hysteresis) {
+    // Restart it whenever the temperature leaves the hysteresis
+    z.settle_ms = now + lim.residency;
+  }
+
+  if (z.settle_ms && ELAPSED(now, z.settle_ms)) { z.settled = true; return; }
+
+  // Give up on a zone that has stopped cooling, e.g., with a target below the room
+  if (temp > target + lim.window && !zone_can_cool(i) && ELAPSED(now, z.cool_check_ms)) {
+    if (z.cool_check_ms && z.cool_temp - temp < float(MIN_COOLING_SLOPE_DEG)) { z.settled = true; return; }
+    z.cool_check_ms = now + SEC_TO_MS(MIN_COOLING_SLOPE_TIME);
+    z.cool_temp = temp;
+  }
+
+  z.settled = false;
+}
+
+void ZoneWait::update() {
+  const millis_t now = millis();
+  LOOP_L_N(i, ZONE_COUNT) if (TEST(zones, i)) update_zone(i, now);
+}
+
+bool ZoneWait::settled() {
+  LOOP_L_N(i, ZONE_COUNT) if (TEST(zones, i) && !zone[i].settled) return false;
+  return true;
+}
+
+int16_t ZoneWait::remaining() {
+  const millis_t now = millis();
+  millis_t left = 0;
+  LOOP_L_N(i, ZONE_COUNT) {
+    if (!TEST(zones, i) || zone[i].settled) continue;
+    if (!zone[i].settle_ms) return -1;
+    if (PENDING(now, zone[i].settle_ms)) NOLESS(left, zone[i].settle_ms - now);
+  }
+  return (left + 999UL) / 1000UL;
+}
+
+bool ZoneWait::wait() {
+  #if DISABLED(BUSY_WHILE_HEATING) && ENABLED(HOST_KEEPALIVE_FEATURE)
+    KEEPALIVE_STATE(NOT_BUSY);
+  #endif
+
+  LCD_MESSAGE(MSG_HEATING);
+
+  millis_t next_temp_ms = 0;
+  wait_for_heatup = true;
+  while (wait_for_heatup && !settled()) {
+    const millis_t now = millis();
+    if (ELAPSED(now, next_temp_ms)) { // Print temps & remaining time every 1s while waiting
+      next_temp_ms = now + 1000UL;
+      thermalManager.print_heater_states(active_extruder);
+      SERIAL_ECHOPGM(" W:");
+      const int16_t left = remaining();
+      if (left < 0) SERIAL_CHAR('?'); else SERIAL_ECHO(left);
+      SERIAL_EOL();
+    }
+    idle();
+    gcode.reset_stepper_timeout(); // Keep steppers powered
+  }
+
+  const bool done = wait_for_heatup;
+  wait_for_heatup = false;
+  zones = 0;
+  ui.reset_status();
+  return done;
+}
+
+#endif // MULTI_ZONE_WAIT
@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/zone_wait.h - Wait for several heaters at once
+ *
+ * A zone is a hotend, the bed or the heated chamber. Each zone with a target
+ * settles once it has stayed near its target for its residency time, just
+ * as with M109, M190 and M191, but all the timers run together. They are
+ * updated by manage_heater, so a wait can be started before homing or
+ * probing and finished afterwards.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define ZONE_BED      (HOTENDS)
+#define ZONE_CHAMBER  (HOTENDS + ENABLED(HAS_HEATED_BED))
+#define ZONE_COUNT    (HOTENDS + ENABLED(HAS_HEATED_BED) + ENABLED(HAS_HEATED_CHAMBER))
+
+typedef uint16_t zone_mask_t;
+#define ZONES_ALL zone_mask_t(_BV(ZONE_COUNT) - 1)
+
+class ZoneWait {
+public:
+  // Start the timers of the given zones. Zones already being timed carry on.
+  // With 'cool' also wait for zones above their target to come down.
+  static void start(const zone_mask_t mask, const bool cool=false);
+  static void stop() { zones = 0; }
+  static bool active() { return zones; }
+
+  // Called by Temperature::manage_heater while active
+  static void update();
+
+  // True when all the zones have settled
+  static bool settled();
+
+  // Seconds until the last zone settles, or -1 if one has yet to reach its window
+  static int16_t remaining();
+
+  // Wait until all the zones have settled. False if cancelled by M108.
+  static bool wait();
+
+private:
+  typedef struct {
+    celsius_t target;           // Target the timer is running for
+    millis_t settle_ms;         // When the zone settles, 0 before it first reaches the window
+    celsius_float_t cool_temp;  // Temperature at the last cooling check
+    millis_t cool_check_ms;     // Time of the next cooling check
+    bool settled;
+  } zone_t;
+
+  static zone_mask_t zones;
+  static bool wait_for_cooling;
+  static zone_t zone[ZONE_COUNT];
+
+  static void update_zone(const uint8_t i, const millis_t now);
+};
+
+extern ZoneWait zone_wait;
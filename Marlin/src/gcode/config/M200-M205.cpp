@@ -249,9 +249,10 @@ void GcodeSuite::M204_report(const bool forReplay/*=true*/) {
  *    Z = Max Z Jerk (units/sec^2)
  *    E = Max E Jerk (units/sec^2)
  *    J = Junction Deviation (mm) (If not using CLASSIC_JERK)
+ *    K = Acceleration Jerk (units/sec^3) (Requires JERK_LIMITED_ACCELERATION)
  */
 void GcodeSuite::M205() {
-  if (!parser.seen("BST" TERN_(HAS_JUNCTION_DEVIATION, "J") TERN_(HAS_CLASSIC_JERK, "XYZE")))
+  if (!parser.seen("BST" TERN_(HAS_JUNCTION_DEVIATION, "J") TERN_(JERK_LIMITED_ACCELERATION, "K") TERN_(HAS_CLASSIC_JERK, "XYZE")))
     return M205_report();
 
   //planner.synchronize();
@@ -272,6 +273,20 @@ void GcodeSuite::M205() {
         SERIAL_ERROR_MSG("?J out of range (0.01 to 0.3)");
     }
   #endif
+  #if ENABLED(JERK_LIMITED_ACCELERATION)
+    #if HAS_CLASSIC_JERK && AXIS_COLLISION('K')
+      #error "Can't set_max_jerk for 'K' axis because 'K' is used for Acceleration Jerk."
+    #endif
+    if (parser.seenval('K')) {
+      const float accel_jerk = parser.value_linear_units();
+      if (accel_jerk > 0) {
+        planner.synchronize();
+        planner.acceleration_jerk = accel_jerk;
+      }
+      else
+        SERIAL_ERROR_MSG("?K must be greater than 0");
+    }
+  #endif
   #if HAS_CLASSIC_JERK
     bool seenZ = false;
     LOGICAL_AXIS_CODE(
@@ -297,6 +312,7 @@ void GcodeSuite::M205_report(const bool forReplay/*=true*/) {
   report_heading_etc(forReplay, F(
     "Advanced (B<min_segment_time_us> S<min_feedrate> T<min_travel_feedrate>"
     TERN_(HAS_JUNCTION_DEVIATION, " J<junc_dev>")
+    TERN_(JERK_LIMITED_ACCELERATION, " K<accel_jerk>")
     #if HAS_CLASSIC_JERK
       NUM_AXIS_GANG(
         " X<max_jerk>", " Y<max_jerk>", " Z<max_jerk>",
@@ -314,6 +330,9 @@ void GcodeSuite::M205_report(const bool forReplay/*=true*/) {
     #if HAS_JUNCTION_DEVIATION
       , PSTR(" J"), LINEAR_UNIT(planner.junction_deviation_mm)
     #endif
+    #if ENABLED(JERK_LIMITED_ACCELERATION)
+      , PSTR(" K"), LINEAR_UNIT(planner.acceleration_jerk)
+    #endif
     #if HAS_CLASSIC_JERK
       , LIST_N(DOUBLE(NUM_AXES),
         SP_X_STR, LINEAR_UNIT(planner.max_jerk.x),
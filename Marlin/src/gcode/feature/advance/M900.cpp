@@ -39,6 +39,7 @@
  *  K<factor>   Set current advance K factor (Slot 0).
  *  L<factor>   Set secondary advance K factor (Slot 1). Requires EXTRA_LIN_ADVANCE_K.
  *  S<0/1>      Activate slot 0 or 1. Requires EXTRA_LIN_ADVANCE_K.
+ *  Q<factor>   Set the nonlinear (quadratic) advance factor K2. Requires LIN_ADVANCE_NONLINEAR.
  */
 void GcodeSuite::M900() {
 
@@ -105,6 +106,21 @@ void GcodeSuite::M900() {
 
   #endif
 
+  #if ENABLED(LIN_ADVANCE_NONLINEAR)
+    float &k2ref = planner.extruder_advance_K2[tool_index], newK2 = k2ref;
+    if (parser.seenval('Q')) {
+      const float K2 = parser.value_float();
+      if (WITHIN(K2, 0, 10))
+        newK2 = K2;
+      else
+        echo_value_oor('Q');
+    }
+    if (newK2 != k2ref) {
+      planner.synchronize();
+      k2ref = newK2;
+    }
+  #endif
+
   if (newK != oldK) {
     planner.synchronize();
     kref = newK;
@@ -140,6 +156,20 @@ void GcodeSuite::M900() {
       #endif
 
     #endif
+
+    #if ENABLED(LIN_ADVANCE_NONLINEAR)
+      SERIAL_ECHO_START();
+      #if EXTRUDERS < 2
+        SERIAL_ECHOLNPGM("Advance K2=", planner.extruder_advance_K2[0]);
+      #else
+        SERIAL_ECHOPGM("Advance K2");
+        EXTRUDER_LOOP() {
+          SERIAL_CHAR(' ', '0' + e, ':');
+          SERIAL_DECIMAL(planner.extruder_advance_K2[e]);
+        }
+        SERIAL_EOL();
+      #endif
+    #endif
   }
 
 }
@@ -148,11 +178,11 @@ void GcodeSuite::M900_report(const bool forReplay/*=true*/) {
   report_heading(forReplay, F(STR_LINEAR_ADVANCE));
   #if EXTRUDERS < 2
     report_echo_start(forReplay);
-    SERIAL_ECHOLNPGM("  M900 K", planner.extruder_advance_K[0]);
+    SERIAL_ECHOLNPGM("  M900 K", planner.extruder_advance_K[0] OPTARG(LIN_ADVANCE_NONLINEAR, " Q", planner.extruder_advance_K2[0]));
   #else
     EXTRUDER_LOOP() {
       report_echo_start(forReplay);
-      SERIAL_ECHOLNPGM("  M900 T", e, " K", planner.extruder_advance_K[e]);
+      SERIAL_ECHOLNPGM("  M900 T", e, " K", planner.extruder_advance_K[e] OPTARG(LIN_ADVANCE_NONLINEAR, " Q", planner.extruder_advance_K2[e]));
     }
   #endif
 }
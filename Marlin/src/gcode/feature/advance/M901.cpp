@@ -0,0 +1,112 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(LIN_ADVANCE_CALIBRATION)
+
+#include "../../gcode.h"
+#include "../../../module/motion.h"
+#include "../../../module/planner.h"
+
+/**
+ * M901: Print a Linear Advance K-factor calibration pattern
+ *
+ * Prints one line per K value with the active tool, each line going
+ * slow-fast-slow. The line with the most even width where the speed
+ * changes has the best K. Any nonlinear K2 (M900 Q) stays in effect,
+ * so K2 can be tuned by repeating the pattern with different M900 Q.
+ * The original K is restored when the pattern is finished.
+ *
+ *  S<K>      Starting K (default 0)
+ *  E<K>      Ending K (default 1)
+ *  P<K>      K increment per line (default 0.1)
+ *  F<rate>   Fast feedrate in mm/min. Slow sections use 1/4 of this. (default 600)
+ *  L<mm>     Length of each line (default 40)
+ *  D<mm>     Spacing between lines (default 5)
+ *  R<ratio>  Extrusion length per mm of travel (default 0.05)
+ *  X<pos>    Left edge of the pattern (default current X)
+ *  Y<pos>    Front edge of the pattern (default current Y)
+ */
+void GcodeSuite::M901() {
+  if (homing_needed_error()) return;
+
+  const float k_start = parser.floatval('S'),
+              k_end   = parser.floatval('E', 1.0f),
+              k_step  = parser.floatval('P', 0.1f);
+
+  if (!WITHIN(k_start, 0, 10) || !WITHIN(k_end, k_start, 10) || k_step <= 0) {
+    SERIAL_ECHOLNPGM("?K range must be 0 <= S <= E <= 10 with P > 0.");
+    return;
+  }
+
+  constexpr uint8_t max_lines = 50;
+  // Clamp as a float, since a tiny P would overflow any integer
+  const uint8_t lines = uint8_t(LROUND(_MIN((k_end - k_start) / k_step, float(max_lines - 1)))) + 1;
+
+  const feedRate_t fr_fast = parser.feedrateval('F', MMM_TO_MMS(600)),
+                   fr_slow = fr_fast * 0.25f;
+
+  const float length  = parser.linearval('L', 40),
+              spacing = parser.linearval('D', 5),
+              ratio   = parser.floatval('R', 0.05f);
+
+  const xy_pos_t origin = {
+    parser.seenval('X') ? RAW_X_POSITION(parser.value_linear_units()) : current_position.x,
+    parser.seenval('Y') ? RAW_Y_POSITION(parser.value_linear_units()) : current_position.y
+  };
+
+  if (!position_is_reachable(origin) || !position_is_reachable(origin.x + length, origin.y + (lines - 1) * spacing)) {
+    SERIAL_ECHOLNPGM("?Pattern out of bounds.");
+    return;
+  }
+
+  // Extrude along X to the given position
+  auto extrude_to = [&](const_float_t x, const_feedRate_t fr) {
+    current_position.e += (x - current_position.x) * ratio;
+    current_position.x = x;
+    line_to_current_position(fr);
+  };
+
+  float &kref = planner.extruder_advance_K[active_extruder];
+  const float old_k = kref;
+
+  for (uint8_t i = 0; i < lines; ++i) {
+    // K is applied when blocks are planned, so let all prior blocks finish first
+    planner.synchronize();
+    kref = k_start + i * k_step;
+    SERIAL_ECHOLNPGM("M901 line ", i + 1, " of ", lines, " K", kref);
+
+    current_position.x = origin.x;
+    current_position.y = origin.y + i * spacing;
+    line_to_current_position(fr_fast);
+
+    extrude_to(origin.x + length * 0.25f, fr_slow);
+    extrude_to(origin.x + length * 0.75f, fr_fast);
+    extrude_to(origin.x + length, fr_slow);
+  }
+
+  planner.synchronize();
+  kref = old_k;
+}
+
+#endif // LIN_ADVANCE_CALIBRATION
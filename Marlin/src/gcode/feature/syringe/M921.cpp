@@ -0,0 +1,74 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(SYRINGE_VOLUME)
+
+#include "../../gcode.h"
+#include "../../../feature/syringe_volume.h"
+
+/**
+ * M921: Syringe volume
+ *
+ *  T<extruder>  Extruder index (Default: active extruder)
+ *  D<mm>        Syringe bore diameter
+ *  C<uL>        Capacity of a full syringe, 0 to stop tracking. Also fills the syringe.
+ *  V<uL>        Volume left in the syringe
+ *  M<uL>        Refill at the next layer below this volume (all syringes)
+ *  R            Refill now
+ *
+ * Save the diameter, capacity and margin with M500.
+ * With no parameters report the settings and the volume left.
+ */
+void GcodeSuite::M921() {
+  if (!parser.seen("DCVMR")) return M921_report(false);
+
+  const int8_t e = get_target_extruder_from_command();
+  if (e < 0) return;
+
+  if (parser.seenval('D')) syringe_volume.diameter[e] = _MAX(parser.value_linear_units(), 0);
+  if (parser.seenval('C')) syringe_volume.volume[e] = syringe_volume.capacity[e] = _MAX(parser.value_float(), 0);
+  if (parser.seenval('V')) syringe_volume.volume[e] = parser.value_float();
+  if (parser.seenval('M')) syringe_volume.margin = _MAX(parser.value_float(), 0);
+
+  if (parser.seen_test('R')) {
+    if (e != active_extruder)
+      SERIAL_ECHO_MSG("?T", e, " is not the active extruder.");
+    else
+      syringe_volume.refill(e);
+  }
+}
+
+void GcodeSuite::M921_report(const bool forReplay/*=true*/) {
+  report_heading(forReplay, F(STR_SYRINGE_VOLUME));
+  EXTRUDER_LOOP() {
+    report_echo_start(forReplay);
+    SERIAL_ECHOPGM("  M921 T", e, " D", LINEAR_UNIT(syringe_volume.diameter[e]), " C", syringe_volume.capacity[e]);
+    if (!forReplay) SERIAL_ECHOPGM(" ; ", syringe_volume.volume[e], "uL left");
+    SERIAL_EOL();
+  }
+  report_echo_start(forReplay);
+  SERIAL_ECHOLNPGM("  M921 M", syringe_volume.margin);
+}
+
+#endif // SYRINGE_VOLUME
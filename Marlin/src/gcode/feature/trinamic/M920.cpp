@@ -0,0 +1,50 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(SYRINGE_MONITOR)
+
+#include "../../gcode.h"
+#include "../../../feature/syringe_monitor.h"
+
+/**
+ * M920: Syringe load monitor
+ *
+ *  S<bool>   Pause the print on a clog or empty syringe
+ *  C<%>      Drop below the baseline for a clog
+ *  A<%>      Rise above the baseline for air or an empty syringe
+ *  R<bool>   Stream every sample as "SG:<result> CS:<current> TSTEP:<time> B:<baseline>"
+ *
+ * A new limit learns the baseline again. With no parameters, report the settings.
+ */
+void GcodeSuite::M920() {
+  if (!parser.seen("SCAR")) return syringe_monitor.report();
+
+  if (parser.seen('S')) syringe_monitor.enabled = parser.value_bool();
+  if (parser.seen('R')) syringe_monitor.stream = parser.value_bool();
+  if (parser.seenval('C')) syringe_monitor.clog_percent = constrain(parser.value_byte(), 1, 99);
+  if (parser.seenval('A')) syringe_monitor.empty_percent = constrain(parser.value_byte(), 1, 250);
+  if (parser.seen("SCA")) syringe_monitor.reset();
+}
+
+#endif // SYRINGE_MONITOR
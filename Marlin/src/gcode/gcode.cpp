@@ -69,6 +69,10 @@ GcodeSuite gcode;
   #include "../feature/fancheck.h"
 #endif
 
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+  #include "../feature/print_time_estimator.h"
+#endif
+
 #include "../MarlinCore.h" // for idle, kill
 
 // Inactivity shutdown
@@ -235,6 +239,9 @@ void GcodeSuite::get_destination_from_command() {
  * Dwell waits immediately. It does not synchronize. Use M400 instead of G4
  */
 void GcodeSuite::dwell(millis_t time) {
+  #if ENABLED(PRINT_TIME_ESTIMATOR)
+    return estimator.dwell(time);
+  #endif
   time += millis();
   while (PENDING(millis(), time)) idle();
 }
@@ -651,6 +658,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
       case 114: M114(); break;                                    // M114: Report current position
       case 115: M115(); break;                                    // M115: Report capabilities
 
+      #if ENABLED(MULTI_ZONE_WAIT)
+        case 116: M116(); break;                                  // M116: Wait for several heaters at once
+      #endif
+
       case 117: TERN_(HAS_STATUS_MESSAGE, M117()); break;         // M117: Set LCD message text, if possible
 
       case 118: M118(); break;                                    // M118: Display a message in the host console
@@ -929,6 +940,39 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 710: M710(); break;                                  // M710: Set Controller Fan settings
       #endif
 
+      #if ENABLED(ISR_CYCLE_STATS)
+        case 720: M720(); break;                                  // M720: Report ISR cycle stats
+      #endif
+
+      #if ENABLED(SD_LINE_INDEX)
+        case 730: M730(); break;                                  // M730: Build or load the SD line index
+        case 731: M731(); break;                                  // M731: Seek the SD file to a line or layer
+      #endif
+
+      #if ENABLED(SERIAL_FLOW_WINDOW)
+        case 735: M735(); break;                                  // M735: Windowed serial flow control
+      #endif
+
+      #if ENABLED(WELL_PLATE_ARRAY)
+        case 740: M740(); break;                                  // M740: Set the well plate geometry
+        case 741: M741(); break;                                  // M741: Print the SD file in each well
+        case 742: M742(); break;                                  // M742: Correct the position of a well
+      #endif
+
+      #if ENABLED(SD_LOG)
+        case 743: M743(); break;                                  // M743: Start the SD telemetry log
+        case 744: M744(); break;                                  // M744: Stop the SD telemetry log
+        case 745: M745(); break;                                  // M745: Add a note to the SD telemetry log
+      #endif
+
+      #if ENABLED(TEMP_HISTORY)
+        case 746: M746(); break;                                  // M746: Send the temperature history
+      #endif
+
+      #if ENABLED(PID_CHAMBER_FEEDFORWARD)
+        case 747: M747(); break;                                  // M747: Set the chamber feed-forward gains
+      #endif
+
       #if ENABLED(GCODE_MACROS)
         case 810: case 811: case 812: case 813: case 814:
         case 815: case 816: case 817: case 818: case 819:
@@ -949,6 +993,9 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
 
       #if ENABLED(LIN_ADVANCE)
         case 900: M900(); break;                                  // M900: Set advance K factor.
+        #if ENABLED(LIN_ADVANCE_CALIBRATION)
+          case 901: M901(); break;                                // M901: Print advance K calibration pattern
+        #endif
       #endif
 
       #if ANY(HAS_MOTOR_CURRENT_SPI, HAS_MOTOR_CURRENT_PWM, HAS_MOTOR_CURRENT_I2C, HAS_MOTOR_CURRENT_DAC)
@@ -979,6 +1026,13 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
           case 914: M914(); break;                                // M914: Set StallGuard sensitivity.
         #endif
         case 919: M919(); break;                                  // M919: Set stepper Chopper Times
+        #if ENABLED(SYRINGE_MONITOR)
+          case 920: M920(); break;                                // M920: Syringe load monitor
+        #endif
+      #endif
+
+      #if ENABLED(SYRINGE_VOLUME)
+        case 921: M921(); break;                                  // M921: Syringe volume
       #endif
 
       #if HAS_L64XX
@@ -1118,7 +1172,12 @@ void GcodeSuite::process_next_command() {
   }
 
   // Parse the next command in the queue
-  parser.parse(command.buffer);
+  #if HAS_PACKED_COMMANDS
+    if (command.packed)
+      parser.parse_packed(command.buffer);
+    else
+  #endif
+      parser.parse(command.buffer);
   process_parsed_command();
 }
 
@@ -1134,6 +1193,7 @@ void GcodeSuite::process_next_command() {
 void GcodeSuite::process_subcommands_now(FSTR_P fgcode) {
   PGM_P pgcode = FTOP(fgcode);
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
+  TERN_(HAS_PACKED_COMMANDS, const bool saved_packed = parser.packed_values);
   for (;;) {
     PGM_P const delim = strchr_P(pgcode, '\n');       // Get address of next newline
     const size_t len = delim ? delim - pgcode : strlen_P(pgcode); // Get the command length
@@ -1145,13 +1205,19 @@ void GcodeSuite::process_subcommands_now(FSTR_P fgcode) {
     if (!delim) break;                                // Last command?
     pgcode = delim + 1;                               // Get the next command
   }
-  parser.parse(saved_cmd);                            // Restore the parser state
+  #if HAS_PACKED_COMMANDS
+    if (saved_packed)
+      parser.parse_packed(saved_cmd);                 // Restore the parser state
+    else
+  #endif
+      parser.parse(saved_cmd);                        // Restore the parser state
 }
 
 #pragma GCC diagnostic pop
 
 void GcodeSuite::process_subcommands_now(char * gcode) {
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
+  TERN_(HAS_PACKED_COMMANDS, const bool saved_packed = parser.packed_values);
   for (;;) {
     char * const delim = strchr(gcode, '\n');         // Get address of next newline
     if (delim) *delim = '\0';                         // Replace with nul
@@ -1161,7 +1227,12 @@ void GcodeSuite::process_subcommands_now(char * gcode) {
     *delim = '\n';                                    // Put back the newline
     gcode = delim + 1;                                // Get the next command
   }
-  parser.parse(saved_cmd);                            // Restore the parser state
+  #if HAS_PACKED_COMMANDS
+    if (saved_packed)
+      parser.parse_packed(saved_cmd);                 // Restore the parser state
+    else
+  #endif
+      parser.parse(saved_cmd);                        // Restore the parser state
 }
 
 #if ENABLED(HOST_KEEPALIVE_FEATURE)
@@ -148,6 +148,7 @@
  * M113 - Get or set the timeout interval for Host Keepalive "busy" messages. (Requires HOST_KEEPALIVE_FEATURE)
  * M114 - Report current position.
  * M115 - Report capabilities. (Extended capabilities requires EXTENDED_CAPABILITIES_REPORT)
+ * M116 - Wait for the hotends, bed and chamber together. T<index>, H, B, C to pick, R to also wait for cooling, P to return at once. (Requires MULTI_ZONE_WAIT)
  * M117 - Display a message on the controller screen. (Requires an LCD)
  * M118 - Display a message in the host console.
  *
@@ -213,7 +214,7 @@
  * M300 - Play beep sound S<frequency Hz> P<duration ms>
  * M301 - Set PID parameters P I and D. (Requires PIDTEMP)
  * M302 - Allow cold extrudes, or set the minimum extrude S<temperature>. (Requires PREVENT_COLD_EXTRUSION)
- * M303 - PID relay autotune S<temperature> sets the target temperature. Default 150C. (Requires PIDTEMP)
+ * M303 - PID relay autotune S<temperature> sets the target temperature. Default 150C. Q to tune from the step response. (Requires PIDTEMP)
  * M304 - Set bed PID parameters P I and D. (Requires PIDTEMPBED)
  * M305 - Set user thermistor parameters R T and P. (Requires TEMP_SENSOR_x 1000)
  * M306 - MPC autotune. (Requires MPCTEMP)
@@ -266,6 +267,18 @@
  * M672 - Set/Reset Duet Smart Effector's sensitivity. (Requires DUET_SMART_EFFECTOR and SMART_EFFECTOR_MOD_PIN)
  * M701 - Load filament (Requires FILAMENT_LOAD_UNLOAD_GCODES)
  * M702 - Unload filament (Requires FILAMENT_LOAD_UNLOAD_GCODES)
+ * M720 - Report ISR cycle stats. R to reset, S1 to apply measured step limits, S0 for defaults. (Requires ISR_CYCLE_STATS)
+ * M730 - Build or load the line and layer index of the selected SD file. R to rebuild. (Requires SD_LINE_INDEX)
+ * M731 - Seek the selected SD file to a line or layer: "M731 L<line>" or "M731 P<layer>". (Requires SD_LINE_INDEX)
+ * M735 - Windowed serial flow control on this port: "M735 S<0|1>". (Requires SERIAL_FLOW_WINDOW)
+ * M740 - Set the well plate geometry: "M740 R<rows> C<cols> I<pitch> J<pitch> X Y Z". (Requires WELL_PLATE_ARRAY)
+ * M741 - Print the selected SD file in each well of the plate. S<well> to start at a well. (Requires WELL_PLATE_ARRAY)
+ * M742 - Correct the position of a well: "M742 W<well> X Y Z". R to clear all. (Requires WELL_PLATE_ARRAY)
+ * M743 - Start the SD telemetry log: "M743 filename". No filename to report. (Requires SD_LOG)
+ * M744 - Stop the SD telemetry log. (Requires SD_LOG)
+ * M745 - Add a note to the SD telemetry log: "M745 C<code> V<value>". (Requires SD_LOG)
+ * M746 - Send the temperature history as a binary frame. S<count> for only the newest samples, C to clear. (Requires TEMP_HISTORY)
+ * M747 - Set the chamber feed-forward gains: "M747 E<heater> A<above> B<below>", R to reset. (Requires PID_CHAMBER_FEEDFORWARD)
  * M808 - Set or Goto a Repeat Marker (Requires GCODE_REPEAT_MARKERS)
  * M810-M819 - Define/execute a G-code macro (Requires GCODE_MACROS)
  * M851 - Set Z probe's XYZ offsets in current units. (Negative values: X=left, Y=front, Z=below)
@@ -286,6 +299,7 @@
  * M871 - Print/reset/clear first layer temperature offset values. (Requires PTC_PROBE, PTC_BED, or PTC_HOTEND)
  * M876 - Handle Prompt Response. (Requires HOST_PROMPT_SUPPORT and not EMERGENCY_PARSER)
  * M900 - Get or Set Linear Advance K-factor. (Requires LIN_ADVANCE)
+ * M901 - Print a Linear Advance K-factor calibration pattern. (Requires LIN_ADVANCE_CALIBRATION)
  * M906 - Set or get motor current in milliamps using axis codes XYZE, etc. Report values if no axis codes given. (Requires at least one _DRIVER_TYPE defined as TMC2130/2160/5130/5160/2208/2209/2660 or L6470)
  * M907 - Set digital trimpot motor current using axis codes. (Requires a board with digital trimpots)
  * M908 - Control digital trimpot directly. (Requires HAS_MOTOR_CURRENT_DAC or DIGIPOTSS_PIN)
@@ -299,6 +313,8 @@
  * M917 - L6470 tuning: Find minimum current thresholds. (Requires at least one _DRIVER_TYPE L6470)
  * M918 - L6470 tuning: Increase speed until max or error. (Requires at least one _DRIVER_TYPE L6470)
  * M919 - Get or Set motor Chopper Times (time_off, hysteresis_end, hysteresis_start) using axis codes XYZE, etc. If no parameters are given, report. (Requires at least one _DRIVER_TYPE defined as TMC2130/2160/5130/5160/2208/2209/2660)
+ * M920 - Syringe load monitor. S<bool> pause on a clog or empty syringe, C<%> clog drop, A<%> empty rise, R<bool> stream the samples. (Requires SYRINGE_MONITOR)
+ * M921 - Syringe volume. T<extruder> D<mm> bore, C<uL> capacity, V<uL> volume left, M<uL> refill margin, R refill now. (Requires SYRINGE_VOLUME)
  * M951 - Set Magnetic Parking Extruder parameters. (Requires MAGNETIC_PARKING_EXTRUDER)
  * M3426 - Read MCP3426 ADC over I2C. (Requires HAS_MCP3426_ADC)
  * M7219 - Control Max7219 Matrix LEDs. (Requires MAX7219_GCODE)
@@ -658,6 +674,20 @@ private:
     #if BOTH(SDCARD_SORT_ALPHA, SDSORT_GCODE)
       static void M34();
     #endif
+    #if ENABLED(SD_LINE_INDEX)
+      static void M730();
+      static void M731();
+    #endif
+    #if ENABLED(WELL_PLATE_ARRAY)
+      static void M740();
+      static void M741();
+      static void M742();
+    #endif
+    #if ENABLED(SD_LOG)
+      static void M743();
+      static void M744();
+      static void M745();
+    #endif
   #endif
 
   #if ENABLED(DIRECT_PIN_CONTROL)
@@ -733,6 +763,10 @@ private:
   static void M114();
   static void M115();
 
+  #if ENABLED(MULTI_ZONE_WAIT)
+    static void M116();
+  #endif
+
   #if HAS_STATUS_MESSAGE
     static void M117();
   #endif
@@ -1136,6 +1170,9 @@ private:
   #if ENABLED(LIN_ADVANCE)
     static void M900();
     static void M900_report(const bool forReplay=true);
+    #if ENABLED(LIN_ADVANCE_CALIBRATION)
+      static void M901();
+    #endif
   #endif
 
   #if HAS_TRINAMIC_CONFIG
@@ -1155,6 +1192,14 @@ private:
       static void M914_report(const bool forReplay=true);
     #endif
     static void M919();
+    #if ENABLED(SYRINGE_MONITOR)
+      static void M920();
+    #endif
+  #endif
+
+  #if ENABLED(SYRINGE_VOLUME)
+    static void M921();
+    static void M921_report(const bool forReplay=true);
   #endif
 
   #if HAS_L64XX
@@ -1238,6 +1283,23 @@ private:
     static void M710_report(const bool forReplay=true);
   #endif
 
+  #if ENABLED(ISR_CYCLE_STATS)
+    static void M720();
+  #endif
+
+  #if ENABLED(SERIAL_FLOW_WINDOW)
+    static void M735();
+  #endif
+
+  #if ENABLED(TEMP_HISTORY)
+    static void M746();
+  #endif
+
+  #if ENABLED(PID_CHAMBER_FEEDFORWARD)
+    static void M747();
+    static void M747_report(const bool forReplay=true);
+  #endif
+
   static void T(const int8_t tool_index);
 
 };
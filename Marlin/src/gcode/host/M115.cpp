@@ -192,6 +192,12 @@ void GcodeSuite::M115() {
     // CONFIG_EXPORT
     cap_line(F("CONFIG_EXPORT"), ENABLED(CONFIGURATION_EMBEDDING));
 
+    // PACKED_GCODE
+    cap_line(F("PACKED_GCODE"), ENABLED(PACKED_GCODE));
+
+    // SERIAL_FLOW_WINDOW (M735)
+    cap_line(F("FLOW_WINDOW"), ENABLED(SERIAL_FLOW_WINDOW));
+
     // Machine Geometry
     #if ENABLED(M115_GEOMETRY_REPORT)
       const xyz_pos_t bmin = { 0, 0, 0 },
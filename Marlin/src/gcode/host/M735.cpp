@@ -0,0 +1,49 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SERIAL_FLOW_WINDOW)
+
+#include "../gcode.h"
+#include "../queue.h"
+
+/**
+ * M735: Windowed serial flow control for the port that sent the command
+ *
+ *  S<bool>  1 to use windowed "ok N<line> C<credits>" replies, 0 for plain "ok"
+ *
+ * With no parameters report the current state. The reply to M735 itself
+ * is already in the new format.
+ */
+void GcodeSuite::M735() {
+  const serial_index_t port = queue.ring_buffer.command_port();
+  if (!port.valid()) return;
+  GCodeQueue::SerialState &serial = queue.serial_state[port.index];
+  if (parser.seen('S')) {
+    serial.windowed = parser.value_bool();
+    serial.resend_pending = false;
+  }
+  SERIAL_ECHOLNPGM("Flow window:", serial.windowed ? int(queue.window_end(port) - serial.last_N) : 0);
+}
+
+#endif // SERIAL_FLOW_WINDOW
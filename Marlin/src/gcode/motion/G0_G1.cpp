@@ -35,6 +35,10 @@
   #include "../../module/stepper.h"
 #endif
 
+#if ENABLED(SYRINGE_VOLUME)
+  #include "../../feature/syringe_volume.h"
+#endif
+
 extern xyze_pos_t destination;
 
 #if ENABLED(VARIABLE_G0_FEEDRATE)
@@ -106,6 +110,9 @@ void GcodeSuite::G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move/*=false*/)) {
 
     #endif // FWRETRACT
 
+    // Refill a low syringe before the first extrusion of a layer
+    TERN_(SYRINGE_VOLUME, syringe_volume.check_move(destination));
+
     #if IS_SCARA
       fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
     #else
@@ -103,7 +103,9 @@ void plan_arc(
     // Preserve direction for circles
     angular_travel = clockwise ? -RADIANS(360) : RADIANS(360);
     abs_angular_travel = RADIANS(360);
-    min_segments = MIN_CIRCLE_SEGMENTS;
+    #ifndef ARC_MAX_CHORDAL_ERROR
+      min_segments = MIN_CIRCLE_SEGMENTS;
+    #endif
   }
   else {
     // Calculate the angle
@@ -120,9 +122,11 @@ void plan_arc(
 
     abs_angular_travel = ABS(angular_travel);
 
-    // Apply minimum segments to the arc
-    const float portion_of_circle = abs_angular_travel / RADIANS(360);  // Portion of a complete circle (0 < N < 1)
-    min_segments = CEIL((MIN_CIRCLE_SEGMENTS) * portion_of_circle);     // Minimum segments for the arc
+    #ifndef ARC_MAX_CHORDAL_ERROR
+      // Apply minimum segments to the arc
+      const float portion_of_circle = abs_angular_travel / RADIANS(360);  // Portion of a complete circle (0 < N < 1)
+      min_segments = CEIL((MIN_CIRCLE_SEGMENTS) * portion_of_circle);     // Minimum segments for the arc
+    #endif
   }
 
   ARC_LIJKUVWE_CODE(
@@ -197,17 +201,44 @@ void plan_arc(
   // Feedrate for the move, scaled by the feedrate multiplier
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
-  // Get the nominal segment length based on settings
-  const float nominal_segment_mm = (
-    #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
-      constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
+  #ifdef ARC_MAX_CHORDAL_ERROR
+
+    // Longest chord that stays within ARC_MAX_CHORDAL_ERROR of the true arc
+    const float max_chord_mm = radius > (ARC_MAX_CHORDAL_ERROR)
+      ? 2 * SQRT((2 * radius - (ARC_MAX_CHORDAL_ERROR)) * (ARC_MAX_CHORDAL_ERROR))
+      : 2 * radius;
+
+    #if ARC_SEGMENTS_PER_SEC
+      // Segments shorter than the planner's minimum segment time are slowed down
+      // when the buffer runs low, so never go below that to get more segments.
+      const float min_time_mm = scaled_fr_mm_s * planner.settings.min_segment_time_us * 1e-6f,
+                  per_sec_mm = _MAX(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), min_time_mm),
+                  chord_mm = _MIN(max_chord_mm, per_sec_mm);
     #else
-      MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
+      const float chord_mm = max_chord_mm;
     #endif
-  );
 
-  // Number of whole segments based on the nominal segment length
-  const float nominal_segments = _MAX(FLOOR(flat_mm / nominal_segment_mm), min_segments);
+    // Get the nominal segment length based on the chord and settings
+    const float nominal_segment_mm = constrain(chord_mm, MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM);
+
+    // Number of segments so none is longer than the nominal segment length
+    const float nominal_segments = _MAX(CEIL(flat_mm / nominal_segment_mm), min_segments);
+
+  #else
+
+    // Get the nominal segment length based on settings
+    const float nominal_segment_mm = (
+      #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
+        constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
+      #else
+        MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
+      #endif
+    );
+
+    // Number of whole segments based on the nominal segment length
+    const float nominal_segments = _MAX(FLOOR(flat_mm / nominal_segment_mm), min_segments);
+
+  #endif
 
   // A new segment length based on the required minimum
   const float segment_mm = constrain(flat_mm / nominal_segments, MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM);
@@ -245,13 +276,23 @@ void plan_arc(
    * without the initial overhead of computing cos() or sin(). By the time the arc needs to be applied
    * a correction, the planner should have caught up to the lag caused by the initial plan_arc overhead.
    * This is important when there are successive arc motions.
+   *
+   * With ARC_MAX_CHORDAL_ERROR the segments of a small radius may span a large angle, where the
+   * approximation no longer holds, so the exact sin() and cos() are used. Each rotated vector is
+   * also pulled back to the radius so round-off can't grow between corrections.
    */
   // Vector rotation matrix values
   xyze_pos_t raw;
   const float theta_per_segment = proportion * angular_travel / segments,
+  #ifdef ARC_MAX_CHORDAL_ERROR
+              sin_T = sin(theta_per_segment),
+              cos_T = cos(theta_per_segment),
+              inv_sq_radius = RECIPROCAL(sq(radius));
+  #else
               sq_theta_per_segment = sq(theta_per_segment),
               sin_T = theta_per_segment - sq_theta_per_segment * theta_per_segment / 6,
               cos_T = 1 - 0.5f * sq_theta_per_segment; // Small angle approximation
+  #endif
 
   #if DISABLED(AUTO_BED_LEVELING_UBL)
     ARC_LIJKUVW_CODE(
@@ -307,6 +348,12 @@ void plan_arc(
         const float r_new_Y = rvec.a * sin_T + rvec.b * cos_T;
         rvec.a = rvec.a * cos_T - rvec.b * sin_T;
         rvec.b = r_new_Y;
+        #ifdef ARC_MAX_CHORDAL_ERROR
+          // Renormalize to the radius with one Newton step, avoiding a sqrt
+          const float k = 1.5f - 0.5f * (sq(rvec.a) + sq(rvec.b)) * inv_sq_radius;
+          rvec.a *= k;
+          rvec.b *= k;
+        #endif
       }
       else
     #endif
@@ -28,6 +28,10 @@
 
 #include "../MarlinCore.h"
 
+#if HAS_PACKED_COMMANDS
+  #include "../feature/packed_gcode.h"
+#endif
+
 // Must be declared for allocation and to satisfy the linker
 // Zero values need no initialization.
 
@@ -62,6 +66,9 @@ uint16_t GCodeParser::codenum;
   // Optimized Parameters
   uint32_t GCodeParser::codebits;  // found bits
   uint8_t GCodeParser::param[26];  // parameter offsets from command_ptr
+  #if HAS_PACKED_COMMANDS
+    bool GCodeParser::packed_values;
+  #endif
 #else
   char *GCodeParser::command_args; // start of parameters
 #endif
@@ -82,6 +89,7 @@ void GCodeParser::reset() {
   TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
+    TERN_(HAS_PACKED_COMMANDS, packed_values = false); // Text values
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
   #endif
 }
@@ -270,6 +278,7 @@ void GCodeParser::parse(char *p) {
   if (letter == 'M') switch (codenum) {
     TERN_(GCODE_MACROS, case 810 ... 819:)
     TERN_(EXPECTED_PRINTER_CHECK, case 16:)
+    TERN_(SD_LOG, case 743:)
     case 23: case 28: case 30: case 117 ... 118: case 928:
       string_arg = unescape_string(p);
       return;
@@ -363,6 +372,137 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if HAS_PACKED_COMMANDS
+
+  /**
+   * Populate the command line state from a command decoded by PackedGCode.
+   * The values are already floats, so only their offsets are set.
+   */
+  void GCodeParser::parse_packed(char *p) {
+
+    reset();
+
+    // Skip the line number
+    if (*p == 'N') {
+      while (*p && *p != ' ') ++p;
+      while (*p == ' ') ++p;
+    }
+    command_ptr = p;
+
+    char *v = p + strlen(p) + 1;
+    packed_gcode_t h;
+    memcpy(&h, v, sizeof(h));
+    v += sizeof(h);
+
+    command_letter = h.letter;
+    codenum = h.codenum;
+    TERN_(USE_GCODE_SUBCODES, subcode = h.subcode);
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (command_letter == 'G'
+        && (codenum <= TERN(ARC_SUPPORT, 3, 1) || TERN0(BEZIER_CURVE_SUPPORT, codenum == 5) || TERN0(G38_PROBE_TARGET, codenum == 38))
+      ) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+
+    codebits = h.codebits;
+    packed_values = true;
+    LOOP_L_N(i, COUNT(param)) {
+      if (TEST32(h.valbits, i)) { param[i] = v - command_ptr; v += sizeof(float); }
+      else if (TEST32(codebits, i)) param[i] = 0;
+    }
+  }
+
+#endif // HAS_PACKED_COMMANDS
+
+#if ENABLED(GCODE_PREPARSE)
+
+  /**
+   * Parse a command as it's queued and store its values as floats after
+   * the command word, as PackedGCode does, so parse_packed can set up the
+   * parser with no text scan when the command runs.
+   *
+   * Commands that use their text (strings, chained G53, M110, addresses)
+   * and values with more than 7 significant digits stay as text.
+   * This may run from idle() within a command, so the state is restored.
+   */
+  // Up to 7 significant digits a float keeps the integer part that strtol reads
+  static bool float_exact(const char *p) {
+    uint8_t digits = 0;
+    for (; *p == '-' || *p == '+'; ++p) { /* nada */ }
+    for (; *p == '0' || *p == '.'; ++p) { /* nada */ }
+    for (; NUMERIC(*p) || *p == '.'; ++p)
+      if (*p != '.' && ++digits > 7) return false;
+    return true;
+  }
+
+  bool GCodeParser::preparse(char * const buf) {
+    // Quoted strings are unescaped in place so they can only be parsed once
+    if (TERN0(GCODE_QUOTED_STRINGS, strchr(buf, '"'))) return false;
+
+    char * const old_command_ptr = command_ptr, * const old_string_arg = string_arg, * const old_value_ptr = value_ptr;
+    const char old_letter = command_letter;
+    const uint16_t old_codenum = codenum;
+    TERN_(USE_GCODE_SUBCODES, const uint8_t old_subcode = subcode);
+    #if ENABLED(GCODE_MOTION_MODES)
+      const int16_t old_motion_codenum = motion_mode_codenum;
+      TERN_(USE_GCODE_SUBCODES, const uint8_t old_motion_subcode = motion_mode_subcode);
+    #endif
+    const uint32_t old_codebits = codebits;
+    const bool old_packed = packed_values;
+    uint8_t old_param[COUNT(param)];
+    memcpy(old_param, param, sizeof(param));
+
+    parse(buf);
+
+    bool ok = command_ptr[0] == command_letter && NUMERIC(command_ptr[1])
+      && (command_letter == 'G' ? !(string_arg || TERN0(CNC_COORDINATE_SYSTEMS, codenum == 53))
+        : (command_letter == 'M' || command_letter == 'T') && !string_arg && codenum != 110 && !WITHIN(codenum, 552, 554)
+      );
+
+    if (ok) {
+      packed_gcode_t h;
+      h.letter = command_letter;
+      h.codenum = codenum;
+      h.subcode = TERN0(USE_GCODE_SUBCODES, subcode);
+      h.codebits = codebits;
+      h.valbits = 0;
+
+      float value[COUNT(param)];
+      for (uint8_t i = 0; ok && i < COUNT(param); ++i) {
+        if (!seenval('A' + i)) continue;
+        if (!float_exact(value_ptr)) ok = false;
+        value[i] = value_float();
+        SBI32(h.valbits, i);
+      }
+
+      // The end of the command word, after the code and subcode
+      char *end = command_ptr + 1;
+      while (NUMERIC(*end)) ++end;
+      if (*end == '.') do ++end; while (NUMERIC(*end));
+
+      ok = ok && PackedGCode::store(buf, end, h, value);
+    }
+
+    command_ptr = old_command_ptr; string_arg = old_string_arg; value_ptr = old_value_ptr;
+    command_letter = old_letter;
+    codenum = old_codenum;
+    TERN_(USE_GCODE_SUBCODES, subcode = old_subcode);
+    #if ENABLED(GCODE_MOTION_MODES)
+      motion_mode_codenum = old_motion_codenum;
+      TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = old_motion_subcode);
+    #endif
+    codebits = old_codebits;
+    packed_values = old_packed;
+    memcpy(param, old_param, sizeof(param));
+
+    return ok;
+  }
+
+#endif // GCODE_PREPARSE
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
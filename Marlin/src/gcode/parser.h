@@ -149,7 +149,7 @@ public:
       if (b) {
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
-          value_ptr = valid_number(ptr) ? ptr : nullptr;
+          value_ptr = (TERN0(HAS_PACKED_COMMANDS, packed_values) || valid_number(ptr)) ? ptr : nullptr;
         }
         else
           value_ptr = nullptr;
@@ -237,6 +237,18 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if HAS_PACKED_COMMANDS
+    static bool packed_values;      // Values are floats from a packed frame
+
+    // Populate all fields from a command decoded by PackedGCode
+    static void parse_packed(char * p);
+  #endif
+
+  #if ENABLED(GCODE_PREPARSE)
+    // Parse a queued command and store its values in place. False if it stays as text.
+    static bool preparse(char * const buf);
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -256,6 +268,13 @@ public:
 
   // Float removes 'E' to prevent scientific notation interpretation
   static float value_float() {
+    #if HAS_PACKED_COMMANDS
+      if (packed_values) {
+        float f = 0;
+        if (value_ptr) memcpy(&f, value_ptr, sizeof(f));
+        return f;
+      }
+    #endif
     if (value_ptr) {
       char *e = value_ptr;
       for (;;) {
@@ -275,8 +294,14 @@ public:
   }
 
   // Code value as a long or ulong
-  static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  static int32_t value_long() {
+    if (TERN0(HAS_PACKED_COMMANDS, packed_values)) return (int32_t)value_float(); // Truncate like strtol
+    return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L;
+  }
+  static uint32_t value_ulong() {
+    if (TERN0(HAS_PACKED_COMMANDS, packed_values)) return (uint32_t)value_long();
+    return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL;
+  }
 
   // Code value for use as time
   static millis_t value_millis() { return value_ulong(); }
@@ -57,6 +57,14 @@ GCodeQueue queue;
   #include "../feature/repeat.h"
 #endif
 
+#if ENABLED(PACKED_GCODE)
+  #include "../feature/packed_gcode.h"
+#endif
+
+#if ENABLED(WELL_PLATE_ARRAY)
+  #include "../feature/plate_array.h"
+#endif
+
 // Frequently used G-code strings
 PGMSTR(G28_STR, "G28");
 
@@ -101,13 +109,44 @@ char GCodeQueue::injected_commands[64]; // = { 0 }
 
 void GCodeQueue::RingBuffer::commit_command(bool skip_ok
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
+  OPTARG(HAS_PACKED_COMMANDS, const bool packed/*=false*/)
 ) {
   commands[index_w].skip_ok = skip_ok;
+  TERN_(HAS_PACKED_COMMANDS, commands[index_w].packed = packed);
   TERN_(HAS_MULTI_SERIAL, commands[index_w].port = serial_ind);
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
   advance_pos(index_w, 1);
 }
 
+#if ENABLED(GCODE_PREPARSE)
+
+  #if ENABLED(SDSUPPORT)
+    // Does the command have the given code, not just the start of a longer one?
+    static bool has_code(const char * const cmd, PGM_P const code) {
+      const char * const c = strstr_P(cmd, code);
+      return c && !NUMERIC(c[strlen_P(code)]);
+    }
+  #endif
+
+  /**
+   * Parse a command as it's queued, unless its text is needed later for the
+   * echo or to be written to SD by M28 or logged by M928, which may itself be
+   * in the queue.
+   */
+  static bool preparse(char * const cmd) {
+    if (DEBUGGING(ECHO)) return false;
+    #if ENABLED(SDSUPPORT)
+      if (card.flag.saving) return false;
+      for (uint8_t i = 0, r = queue.ring_buffer.index_r; i < queue.ring_buffer.length; ++i, r = (r + 1) % BUFSIZE) {
+        const char * const c = queue.ring_buffer.commands[r].buffer;
+        if (has_code(c, PSTR("M28")) || has_code(c, PSTR("M928"))) return false;
+      }
+    #endif
+    return parser.preparse(cmd);
+  }
+
+#endif
+
 /**
  * Copy a command from RAM into the main command buffer.
  * Return true if the command was successfully added.
@@ -118,7 +157,10 @@ bool GCodeQueue::RingBuffer::enqueue(const char *cmd, bool skip_ok/*=true*/
 ) {
   if (*cmd == ';' || length >= BUFSIZE) return false;
   strcpy(commands[index_w].buffer, cmd);
-  commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
+  commit_command(skip_ok
+    OPTARG(HAS_MULTI_SERIAL, serial_ind)
+    OPTARG(HAS_PACKED_COMMANDS, TERN0(GCODE_PREPARSE, preparse(commands[index_w].buffer)))
+  );
   return true;
 }
 
@@ -239,6 +281,10 @@ void GCodeQueue::enqueue_now_P(PGM_P const pgcode) {
  *   N<int>  Line number of the command, if any
  *   P<int>  Planner space remaining
  *   B<int>  Block queue space remaining
+ *
+ * On a port using SERIAL_FLOW_WINDOW send instead:
+ *   N<int>  Line number of the command, or the last line received
+ *   C<int>  Lines the host may send beyond N before the next "ok"
  */
 void GCodeQueue::RingBuffer::ok_to_send() {
   #if NO_TIMEOUTS > 0
@@ -253,6 +299,14 @@ void GCodeQueue::RingBuffer::ok_to_send() {
   #endif
   if (command.skip_ok) return;
   SERIAL_ECHOPGM(STR_OK);
+  #if ENABLED(SERIAL_FLOW_WINDOW)
+    const serial_index_t port = command_port();
+    if (serial_state[port.index].windowed) {
+      const long n = command.buffer[0] == 'N' ? strtol(command.buffer + 1, nullptr, 10) : serial_state[port.index].last_N;
+      SERIAL_ECHOLNPGM(" N", n, " C", window_end(port) - n);
+      return;
+    }
+  #endif
   #if ENABLED(ADVANCED_OK)
     char* p = command.buffer;
     if (*p == 'N') {
@@ -274,8 +328,18 @@ void GCodeQueue::flush_and_request_resend(const serial_index_t serial_ind) {
     if (!serial_ind.valid()) return;              // Optimization here, skip if the command came from SD or Flash Drive
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
   #endif
+  SerialState &serial = serial_state[serial_ind.index];
+  #if ENABLED(SERIAL_FLOW_WINDOW)
+    // A windowed host rewinds to the requested line and keeps its credits.
+    // Lines already in flight are dropped as they arrive.
+    if (serial.windowed) {
+      serial.resend_pending = true;
+      SERIAL_ECHOLNPGM(STR_RESEND, serial.last_N + 1);
+      return;
+    }
+  #endif
   SERIAL_FLUSH();
-  SERIAL_ECHOLNPGM(STR_RESEND, serial_state[serial_ind.index].last_N + 1);
+  SERIAL_ECHOLNPGM(STR_RESEND, serial.last_N + 1);
   SERIAL_ECHOLNPGM(STR_OK);
 }
 
@@ -306,7 +370,11 @@ void GCodeQueue::gcode_line_error(FSTR_P const ferr, const serial_index_t serial
   PORT_REDIRECT(SERIAL_PORTMASK(serial_ind)); // Reply to the serial port that sent the command
   SERIAL_ERROR_START();
   SERIAL_ECHOLNF(ferr, serial_state[serial_ind.index].last_N);
-  while (read_serial(serial_ind) != -1) { /* nada */ } // Clear out the RX buffer. Why don't use flush here ?
+  #if ENABLED(SERIAL_FLOW_WINDOW)
+    // Keep whole lines in flight so they can be dropped by number
+    if (!serial_state[serial_ind.index].windowed)
+  #endif
+      while (read_serial(serial_ind) != -1) { /* nada */ } // Clear out the RX buffer. Why don't use flush here ?
   flush_and_request_resend(serial_ind);
   serial_state[serial_ind.index].count = 0;
 }
@@ -321,6 +389,7 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_QUOTED 2
 #define PS_PAREN  3
 #define PS_ESC    4
+#define PS_PACKED 0x80
 
 inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
 
@@ -389,6 +458,49 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return is_empty;                    // Inform the caller
 }
 
+#if ENABLED(PACKED_GCODE)
+
+  /**
+   * Check a complete packed frame from the line buffer and decode it
+   * straight into the next queue slot. Return false after a line error.
+   */
+  bool GCodeQueue::enqueue_packed(SerialState &serial, const serial_index_t serial_ind) {
+    const uint8_t * const frame = (uint8_t*)serial.line_buffer;
+    long gcode_N;
+    bool numbered;
+    if (!PackedGCode::check(frame, gcode_N, numbered)) {
+      gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), serial_ind);
+      return false;
+    }
+
+    if (numbered && gcode_N != serial.last_N + 1) {
+      if (TERN0(SERIAL_FLOW_WINDOW, serial.resend_pending)) return true;
+      gcode_line_error(F(STR_ERR_LINE_NO), serial_ind);
+      return false;
+    }
+    if (!numbered && TERN0(SERIAL_FLOW_WINDOW, serial.resend_pending)) return true;
+
+    // Files being written get text only
+    if (TERN0(SDSUPPORT, card.flag.saving) || !PackedGCode::decode(frame, serial_ind, ring_buffer.commands[ring_buffer.index_w].buffer)) {
+      gcode_line_error(F(STR_ERR_PACKED_FRAME), serial_ind);
+      return false;
+    }
+
+    if (numbered) {
+      serial.last_N = gcode_N;
+      TERN_(SERIAL_FLOW_WINDOW, serial.resend_pending = false);
+    }
+
+    #if NO_TIMEOUTS > 0
+      last_command_time = millis();
+    #endif
+
+    ring_buffer.commit_command(false OPTARG(HAS_MULTI_SERIAL, serial_ind), true);
+    return true;
+  }
+
+#endif // PACKED_GCODE
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
@@ -446,6 +558,27 @@ void GCodeQueue::get_serial_commands() {
       const char serial_char = (char)c;
       SerialState &serial = serial_state[p];
 
+      #if ENABLED(PACKED_GCODE)
+        // A sync byte at the start of a line begins a packed frame
+        if (serial.input_state == PS_PACKED || (!serial.count && serial.input_state == PS_NORMAL && uint8_t(serial_char) == PACKED_GCODE_SYNC)) {
+          serial.input_state = PS_PACKED;
+          serial.line_buffer[serial.count++] = serial_char;
+          if (serial.count < 2) continue;
+          const uint8_t size = uint8_t(serial.line_buffer[1]);
+          if (size <= PACKED_GCODE_MAX_SIZE && serial.count < size + 4) continue;
+
+          serial.input_state = PS_NORMAL;
+          serial.count = 0;
+          if (size > PACKED_GCODE_MAX_SIZE) {
+            gcode_line_error(F(STR_ERR_PACKED_FRAME), p);
+            break;
+          }
+          // In case of error on a serial port, don't prevent other serial port from making progress
+          if (!enqueue_packed(serial, p)) break;
+          continue;
+        }
+      #endif
+
       if (ISEOL(serial_char)) {
 
         // Reset our state, continue if the line was empty
@@ -457,6 +590,10 @@ void GCodeQueue::get_serial_commands() {
         while (*command == ' ') command++;                   // Skip leading spaces
         char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
 
+        #if ENABLED(SERIAL_FLOW_WINDOW)
+          if (!npos && serial.resend_pending) continue;      // Only numbered lines until the resend arrives
+        #endif
+
         if (npos) {
 
           const bool M110 = !!strstr_P(command, PSTR("M110"));
@@ -469,6 +606,10 @@ void GCodeQueue::get_serial_commands() {
           const long gcode_N = strtol(npos + 1, nullptr, 10);
 
           if (gcode_N != serial.last_N + 1 && !M110) {
+            #if ENABLED(SERIAL_FLOW_WINDOW)
+              // Lines that were in flight when the resend was requested
+              if (serial.resend_pending) continue;
+            #endif
             // In case of error on a serial port, don't prevent other serial port from making progress
             gcode_line_error(F(STR_ERR_LINE_NO), p);
             break;
@@ -491,6 +632,7 @@ void GCodeQueue::get_serial_commands() {
           }
 
           serial.last_N = gcode_N;
+          TERN_(SERIAL_FLOW_WINDOW, serial.resend_pending = false);
         }
         #if ENABLED(SDSUPPORT)
           // Pronterface "M29" and "M29 " has no line number
@@ -556,8 +698,36 @@ void GCodeQueue::get_serial_commands() {
     // Get commands if there are more in the file
     if (!IS_SD_FETCHING()) return;
 
+    #if ENABLED(GCODE_REPEAT_CACHE)
+      // Replay a cached M808 loop body before reading on
+      if (repeat.is_replaying()) {
+        bool packed;
+        while (!ring_buffer.full() && repeat.replay_command(ring_buffer.commands[ring_buffer.index_w].buffer, packed))
+          ring_buffer.commit_command(true OPTARG(HAS_MULTI_SERIAL, serial_index_t()) OPTARG(HAS_PACKED_COMMANDS, packed));
+        if (repeat.is_replaying()) return;
+      }
+    #endif
+
+    #if ENABLED(WELL_PLATE_ARRAY)
+      // Read the file again for the next well of a plate array
+      if (card.eof() && plate_array.running) {
+        if (ring_buffer.full()) return;
+        char cmd[12];
+        const uint8_t well = plate_array.next_well();
+        if (plate_array.running)
+          sprintf_P(cmd, PSTR("M741 W%u"), well);
+        else
+          strcpy_P(cmd, PSTR("M741 E"));
+        ring_buffer.enqueue(cmd);
+        if (plate_array.running) card.setIndex(0);
+      }
+    #endif
+
+    // The file can end with a replayed loop or a plate array
+    if (card.eof()) { card.fileHasFinished(); return; }
+
     int sd_count = 0;
-    while (!ring_buffer.full() && !card.eof()) {
+    while (!ring_buffer.full() && !card.eof() && !TERN0(GCODE_REPEAT_CACHE, repeat.is_replaying())) {
       const int16_t n = card.get();
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
@@ -582,13 +752,19 @@ void GCodeQueue::get_serial_commands() {
           #endif
 
           // Put the new command into the buffer (no "ok" sent)
-          ring_buffer.commit_command(true);
+          ring_buffer.commit_command(true
+            OPTARG(HAS_MULTI_SERIAL, serial_index_t())
+            OPTARG(HAS_PACKED_COMMANDS, TERN0(GCODE_PREPARSE, preparse(command.buffer)))
+          );
+
+          TERN_(GCODE_REPEAT_CACHE, repeat.cache_command(command.buffer, TERN0(HAS_PACKED_COMMANDS, command.packed)));
 
           // Prime Power-Loss Recovery for the NEXT commit_command
           TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
         }
 
-        if (card.eof()) card.fileHasFinished();         // Handle end of file reached
+        if (card.eof() && !TERN0(GCODE_REPEAT_CACHE, repeat.is_replaying()) && !TERN0(WELL_PLATE_ARRAY, plate_array.running))
+          card.fileHasFinished();                       // Handle end of file reached
       }
       else
         process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
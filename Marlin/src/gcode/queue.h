@@ -43,6 +43,10 @@ public:
     int count;                      //!< Number of characters read in the current line of serial input
     char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
     uint8_t input_state;            //!< The input state
+    #if ENABLED(SERIAL_FLOW_WINDOW)
+      bool windowed,                //!< Host negotiated windowed flow control with M735
+           resend_pending;          //!< Drop out-of-sequence lines until the resend arrives
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -59,6 +63,9 @@ public:
   struct CommandLine {
     char buffer[MAX_CMD_SIZE];      //!< The command buffer
     bool skip_ok;                   //!< Skip sending ok when command is processed?
+    #if HAS_PACKED_COMMANDS
+      bool packed;                  //!< Decoded from a packed frame. See feature/packed_gcode.h
+    #endif
     #if HAS_MULTI_SERIAL
       serial_index_t port;          //!< Serial port the command was received on
     #endif
@@ -81,6 +88,7 @@ public:
 
     void commit_command(bool skip_ok
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind = serial_index_t())
+      OPTARG(HAS_PACKED_COMMANDS, const bool packed = false)
     );
 
     bool enqueue(const char *cmd, bool skip_ok = true
@@ -191,6 +199,10 @@ public:
    *   N<int>  Line number of the command, if any
    *   P<int>  Planner space remaining
    *   B<int>  Block queue space remaining
+   *
+   * If SERIAL_FLOW_WINDOW is enabled and negotiated, send instead:
+   *   N<int>  Line number of the command
+   *   C<int>  Lines the host may send beyond that line
    */
   static void ok_to_send() { ring_buffer.ok_to_send(); }
 
@@ -203,7 +215,25 @@ public:
   /**
    * (Re)Set the current line number for the last received command
    */
-  static void set_current_line_number(long n) { serial_state[ring_buffer.command_port().index].last_N = n; }
+  static void set_current_line_number(long n) {
+    SerialState &serial = serial_state[ring_buffer.command_port().index];
+    #if ENABLED(SERIAL_FLOW_WINDOW)
+      // A numbered M110 was applied on arrival. Later lines may have arrived since.
+      if (serial.windowed && ring_buffer.commands[ring_buffer.index_r].buffer[0] == 'N') return;
+      serial.resend_pending = false;
+    #endif
+    serial.last_N = n;
+  }
+
+  #if ENABLED(SERIAL_FLOW_WINDOW)
+    /**
+     * Last line number the host may send on a port. Lines only move the
+     * window when they leave the queue, so it never shrinks.
+     */
+    static long window_end(const serial_index_t serial_ind) {
+      return serial_state[serial_ind.index].last_N + (BUFSIZE - ring_buffer.length) + (SERIAL_FLOW_WINDOW_RX_LINES);
+    }
+  #endif
 
   #if ENABLED(BUFFER_MONITORING)
 
@@ -261,6 +291,10 @@ private:
 
   static void gcode_line_error(FSTR_P const ferr, const serial_index_t serial_ind);
 
+  #if ENABLED(PACKED_GCODE)
+    static bool enqueue_packed(SerialState &serial, const serial_index_t serial_ind);
+  #endif
+
   friend class GcodeSuite;
 };
 
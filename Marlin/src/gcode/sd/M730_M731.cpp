@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SD_LINE_INDEX)
+
+#include "../gcode.h"
+#include "../../sd/cardreader.h"
+#include "../../feature/sd_index.h"
+
+/**
+ * M730: Index the selected SD file by line and layer
+ *
+ * Loads the sidecar index if there is one for this file,
+ * otherwise reads the whole file and saves a new sidecar.
+ * Not available while the file is printing.
+ *
+ *  R  Rebuild the index even if a sidecar exists
+ */
+void GcodeSuite::M730() {
+  if (!card.isFileOpen()) { SERIAL_ECHOLNPGM("?No file selected."); return; }
+
+  if (parser.seen_test('R') || !(sd_index.is_current() || sd_index.load())) {
+    if (card.isPrinting()) { SERIAL_ECHOLNPGM("?Pause the print to build the index."); return; }
+    SERIAL_ECHOLNPGM("Indexing ", card.getFileSize(), " bytes...");
+    if (!sd_index.build()) { SERIAL_ECHOLNPGM("?Index failed."); return; }
+    if (!sd_index.save()) SERIAL_ECHOLNPGM("Index not saved.");
+  }
+
+  sd_index.report();
+}
+
+/**
+ * M731: Set the SD position of the selected file to a line or layer
+ *
+ * Use while the print is paused or before it starts, then M24 to continue
+ * from there. Requires an index from M730.
+ *
+ *  L<line>   Line number, starting at 1
+ *  P<layer>  Layer number, counting SD_INDEX_LAYER_MARKER lines from 0
+ */
+void GcodeSuite::M731() {
+  if (!card.isFileOpen()) { SERIAL_ECHOLNPGM("?No file selected."); return; }
+  if (card.isPrinting()) { SERIAL_ECHOLNPGM("?Pause the print first."); return; }
+  if (!sd_index.is_current() && !sd_index.load()) { SERIAL_ECHOLNPGM("?Index the file with M730."); return; }
+
+  bool ok;
+  if (parser.seenval('L'))
+    ok = sd_index.seek_line(parser.value_ulong());
+  else if (parser.seenval('P'))
+    ok = sd_index.seek_layer(parser.value_ulong());
+  else
+    return;
+
+  if (ok)
+    SERIAL_ECHOLNPGM(STR_SD_PRINTING_BYTE, card.getIndex());
+  else
+    SERIAL_ECHOLNPGM("?Out of range.");
+}
+
+#endif // SD_LINE_INDEX
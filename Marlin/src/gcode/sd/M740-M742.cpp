@@ -0,0 +1,133 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(WELL_PLATE_ARRAY)
+
+#include "../gcode.h"
+#include "../../sd/cardreader.h"
+#include "../../feature/plate_array.h"
+#include "../../MarlinCore.h" // for startOrResumeJob
+
+/**
+ * M740: Set the well plate geometry for M741
+ *
+ *  R<rows>   Rows of wells, lettered from A
+ *  C<cols>   Columns of wells, numbered from 1
+ *  I<pitch>  Distance from one column to the next, along X
+ *  J<pitch>  Distance from one row to the next, along Y. Negative if row B is in front of row A.
+ *  X Y Z     Center of well A1 in the workspace M741 starts from
+ *
+ * With no parameters, report the geometry.
+ *
+ * Example: M740 R8 C12 I9 J-9 X14.38 Y74.24  ; 96 wells with A1 at the back left
+ */
+void GcodeSuite::M740() {
+  if (!parser.seen("RCIJXYZ")) return plate_array.report_geometry();
+  if (plate_array.active) { SERIAL_ECHOLNPGM("?Plate array is printing."); return; }
+
+  const uint8_t rows = parser.byteval('R', plate_array.rows), cols = parser.byteval('C', plate_array.cols);
+  if (!WITHIN(rows, 1, 26) || !cols || rows * cols > WELL_PLATE_MAX_WELLS) {
+    SERIAL_ECHOLNPGM("?Up to 26 rows and " STRINGIFY(WELL_PLATE_MAX_WELLS) " wells.");
+    return;
+  }
+  plate_array.rows = rows;
+  plate_array.cols = cols;
+
+  if (parser.seenval('I')) plate_array.pitch.x = parser.value_linear_units();
+  if (parser.seenval('J')) plate_array.pitch.y = parser.value_linear_units();
+  if (parser.seenval('X')) plate_array.origin.x = parser.value_linear_units();
+  if (parser.seenval('Y')) plate_array.origin.y = parser.value_linear_units();
+  if (parser.seenval('Z')) plate_array.origin.z = parser.value_linear_units();
+}
+
+/**
+ * M741: Print the selected SD file once in each well
+ *
+ * The file is written for one well, centered at X0 Y0. Before each well
+ * the workspace is shifted to its center, from the workspace at the start.
+ *
+ *  S<well>  First well to print, from 0 (A1)
+ *
+ * Wells are M486 objects. Cancel any well not yet started with M486 P<well>.
+ *
+ * The job also queues these between the wells:
+ *  W<well>  Shift the workspace to a well
+ *  E        Restore the workspace
+ */
+void GcodeSuite::M741() {
+  if (parser.seenval('W')) {
+    if (plate_array.active) plate_array.goto_well(parser.value_byte());
+    return;
+  }
+  if (parser.seen_test('E')) return plate_array.end();
+
+  if (!card.isFileOpen()) { SERIAL_ECHOLNPGM("?No file selected."); return; }
+  if (card.isPrinting() || plate_array.active) { SERIAL_ECHOLNPGM("?Already printing."); return; }
+
+  const uint8_t first = parser.byteval('S');
+  if (first >= plate_array.count()) { SERIAL_ECHOLNPGM("?Set the plate with M740."); return; }
+
+  // Starting the job clears the objects, so set up the wells after it
+  startOrResumeJob();
+  plate_array.start(first);
+
+  card.setIndex(0);
+  card.startOrResumeFilePrinting();
+}
+
+/**
+ * M742: Correct the position of a well
+ *
+ *  W<well>  Well to correct, from 0 (A1)
+ *  X Y Z    Correction added to the position of the well
+ *  R        Clear all corrections
+ *
+ * With only W, report the well. With no parameters, report all the corrected wells.
+ * A correction takes effect the next time its well starts.
+ */
+void GcodeSuite::M742() {
+  if (parser.seen_test('R')) ZERO(plate_array.correction);
+
+  if (!parser.seenval('W')) {
+    LOOP_L_N(w, plate_array.count()) {
+      const float * const c = plate_array.correction[w];
+      if (c[X_AXIS] || c[Y_AXIS] || c[Z_AXIS]) plate_array.report_well(w);
+    }
+    return;
+  }
+
+  const uint8_t w = parser.value_byte();
+  if (w >= plate_array.count()) { SERIAL_ECHOLNPGM("?No such well."); return; }
+
+  float * const c = plate_array.correction[w];
+  if (parser.seen("XYZ")) {
+    if (parser.seenval('X')) c[X_AXIS] = parser.value_linear_units();
+    if (parser.seenval('Y')) c[Y_AXIS] = parser.value_linear_units();
+    if (parser.seenval('Z')) c[Z_AXIS] = parser.value_linear_units();
+  }
+  else
+    plate_array.report_well(w);
+}
+
+#endif // WELL_PLATE_ARRAY
@@ -0,0 +1,66 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SD_LOG)
+
+#include "../gcode.h"
+#include "../../feature/sd_log.h"
+
+/**
+ * M743: Start the SD telemetry log, appending to the given file
+ *
+ *   M743 PRINT.LOG
+ *
+ * With no file name, report the state of the log.
+ */
+void GcodeSuite::M743() {
+  if (!parser.string_arg || !*parser.string_arg) { sd_log.report(); return; }
+
+  if (sd_log.start(parser.string_arg))
+    SERIAL_ECHOLNPGM("SD log: ", parser.string_arg);
+  else
+    SERIAL_ECHOLNPGM("?Can't open ", parser.string_arg);
+}
+
+/**
+ * M744: Stop the SD telemetry log and close the file
+ */
+void GcodeSuite::M744() {
+  sd_log.stop();
+  sd_log.report();
+}
+
+/**
+ * M745: Add a note to the SD telemetry log
+ *
+ *  C<code>   Code chosen by the host, e.g., for a regulator pressure reading
+ *  V<value>  The value to log
+ */
+void GcodeSuite::M745() {
+  if (!parser.seenval('V')) return;
+  const float value = parser.value_float();
+  sd_log.note(parser.ushortval('C'), value);
+}
+
+#endif // SD_LOG
@@ -0,0 +1,51 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(ISR_CYCLE_STATS)
+
+#include "../gcode.h"
+#include "../../feature/isr_stats.h"
+
+/**
+ * M720: Report measured ISR cycle counts and multistepping limits
+ *
+ *  R       Reset the collected stats
+ *  S1      Derive the multistepping limits from the collected stats
+ *  S0      Restore the estimated multistepping limits
+ */
+void GcodeSuite::M720() {
+  if (parser.seen_test('R')) isr_stats.reset();
+
+  if (parser.seenval('S')) {
+    if (!parser.value_bool())
+      isr_stats.default_step_limits();
+    else if (!isr_stats.apply_step_limits())
+      SERIAL_ECHOLNPGM("?Need ", ISR_CYCLE_STATS_MIN_SAMPLES, " Stepper ISR samples. Run some moves first.");
+  }
+
+  isr_stats.report();
+}
+
+#endif // ISR_CYCLE_STATS
@@ -0,0 +1,72 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MULTI_ZONE_WAIT)
+
+#include "../gcode.h"
+#include "../../feature/zone_wait.h"
+
+/**
+ * M116: Wait for the hotends, bed and chamber together
+ *
+ *  T<index>  Wait for this hotend
+ *  H         Wait for all the hotends
+ *  B         Wait for the bed
+ *  C         Wait for the chamber
+ *  R         Also wait for heaters above their targets to cool down
+ *  P         Only start the residency timers and return. A later M116
+ *            waits for the heaters that haven't settled yet.
+ *
+ * With none of T, H, B or C wait for every heater with a target.
+ * Each heater uses its own window and residency time, as in M109/M190/M191.
+ *
+ * Examples:
+ *   M104 T0 S37 ; M104 T1 S4 ; M140 S37
+ *   M116 P      ; Start the timers
+ *   G28         ; Home while the heaters settle
+ *   M116        ; Wait for whatever is left
+ */
+void GcodeSuite::M116() {
+  if (!zone_wait.active() || parser.seen("THBCR")) {
+    zone_mask_t mask = 0;
+    if (parser.seen('T')) {
+      const int8_t e = parser.value_int();
+      if (!WITHIN(e, 0, HOTENDS - 1)) { SERIAL_ERROR_MSG(STR_INVALID_EXTRUDER); return; }
+      SBI(mask, e);
+    }
+    if (parser.seen_test('H')) mask |= _BV(HOTENDS) - 1;
+    #if HAS_HEATED_BED
+      if (parser.seen_test('B')) SBI(mask, ZONE_BED);
+    #endif
+    #if HAS_HEATED_CHAMBER
+      if (parser.seen_test('C')) SBI(mask, ZONE_CHAMBER);
+    #endif
+    if (!parser.seen("THBC")) mask = ZONES_ALL;
+    zone_wait.start(mask, parser.seen_test('R'));
+  }
+
+  if (!parser.seen_test('P')) zone_wait.wait();
+}
+
+#endif // MULTI_ZONE_WAIT
@@ -42,6 +42,10 @@
  *  C<cycles>       Number of times to repeat the procedure. (Minimum: 3, Default: 5)
  *  U<bool>         Flag to apply the result to the current PID values
  *
+ * With PID_STEP_AUTOTUNE:
+ *  Q               Tune from the step response, stopping as soon as the result is good
+ *  A               With Q, tune every PID zone that has a target, all at once
+ *
  * With PID_DEBUG, PID_BED_DEBUG, or PID_CHAMBER_DEBUG:
  *  D               Toggle PID debugging and EXIT without further action.
  */
@@ -58,6 +62,31 @@ void GcodeSuite::M303() {
     }
   #endif
 
+  #if ENABLED(PID_STEP_AUTOTUNE)
+    if (parser.seen_test('Q') && parser.seen_test('A')) {
+      Temperature::step_tune_zone_t zones[PID_STEP_ZONES];
+      uint8_t n = 0;
+      #if ENABLED(PIDTEMP)
+        HOTEND_LOOP() if (thermalManager.degTargetHotend(e)) zones[n++] = { (heater_id_t)e, thermalManager.degTargetHotend(e) };
+      #endif
+      #if ENABLED(PIDTEMPBED)
+        if (thermalManager.degTargetBed()) zones[n++] = { H_BED, thermalManager.degTargetBed() };
+      #endif
+      #if ENABLED(PIDTEMPCHAMBER)
+        if (thermalManager.degTargetChamber()) zones[n++] = { H_CHAMBER, thermalManager.degTargetChamber() };
+      #endif
+      if (!n) { SERIAL_ECHOPGM(STR_PID_AUTOTUNE); SERIAL_ECHOLNPGM("No zone has a target"); return; }
+
+      #if DISABLED(BUSY_WHILE_HEATING)
+        KEEPALIVE_STATE(NOT_BUSY);
+      #endif
+      LCD_MESSAGE(MSG_PID_AUTOTUNE);
+      thermalManager.PID_step_autotune(zones, n, parser.boolval('U'));
+      ui.reset_status();
+      return;
+    }
+  #endif
+
   const heater_id_t hid = (heater_id_t)parser.intval('E');
   celsius_t default_temp;
   switch (hid) {
@@ -94,7 +123,14 @@ void GcodeSuite::M303() {
   #endif
 
   LCD_MESSAGE(MSG_PID_AUTOTUNE);
-  thermalManager.PID_autotune(temp, hid, c, u);
+  #if ENABLED(PID_STEP_AUTOTUNE)
+    if (parser.seen_test('Q')) {
+      const Temperature::step_tune_zone_t zone = { hid, temp };
+      thermalManager.PID_step_autotune(&zone, 1, u);
+    }
+    else
+  #endif
+      thermalManager.PID_autotune(temp, hid, c, u);
   ui.reset_status();
 }
 
@@ -0,0 +1,43 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(TEMP_HISTORY)
+
+#include "../gcode.h"
+#include "../../feature/temp_history.h"
+
+/**
+ * M746: Send the temperature history to the host as a binary frame
+ *
+ *  S<count>  Only send the newest samples
+ *  C         Clear the history instead
+ *
+ * The frame follows a "TEMP_HISTORY:<bytes>" line. See feature/temp_history.h.
+ */
+void GcodeSuite::M746() {
+  if (parser.seen_test('C')) { temp_history.clear(); return; }
+  temp_history.dump(parser.ushortval('S', TEMP_HISTORY_SAMPLES));
+}
+
+#endif // TEMP_HISTORY
@@ -0,0 +1,73 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PID_CHAMBER_FEEDFORWARD)
+
+#include "../gcode.h"
+#include "../../module/temperature.h"
+
+static chamber_ff_t* ff_for(const int8_t e) {
+  #if ENABLED(PIDTEMPBED)
+    if (e == -1) return &thermalManager.temp_bed.ff;
+  #endif
+  #if ENABLED(PIDTEMP)
+    if (WITHIN(e, 0, HOTENDS - 1)) return &thermalManager.temp_hotend[e].ff;
+  #endif
+  return nullptr;
+}
+
+/**
+ * M747: Set the chamber feed-forward gains of a PID heater
+ *
+ *  E<index>  Hotend index, or -1 for the bed (Default 0)
+ *  A<gain>   Output per °C of target above the chamber
+ *  B<gain>   Output per °C of target below the chamber (Peltier cooling)
+ *  R         Reset the gains to zero and learn them again
+ *
+ * The gains are learned while the heater holds its target. Save them with M500.
+ * With no parameters report the current gains.
+ */
+void GcodeSuite::M747() {
+  if (!parser.seen("ABR")) return M747_report();
+
+  const int8_t e = parser.intval('E');
+  chamber_ff_t * const ff = ff_for(e);
+  if (!ff) { SERIAL_ERROR_MSG(STR_INVALID_EXTRUDER); return; }
+
+  if (parser.seen_test('R')) *ff = chamber_ff_t();
+  if (parser.seenval('A')) ff->Ka[0] = _MAX(parser.value_float(), 0);
+  if (parser.seenval('B')) ff->Ka[1] = _MAX(parser.value_float(), 0);
+  ff->settling = false;
+}
+
+void GcodeSuite::M747_report(const bool forReplay/*=true*/) {
+  report_heading(forReplay, F(STR_CHAMBER_FEEDFORWARD));
+  for (int8_t e = TERN(PIDTEMPBED, -1, 0); e < TERN(PIDTEMP, HOTENDS, 0); ++e) {
+    const chamber_ff_t * const ff = ff_for(e);
+    report_echo_start(forReplay);
+    SERIAL_ECHOLNPGM("  M747 E", e, " A", ff->Ka[0], " B", ff->Ka[1]);
+  }
+}
+
+#endif // PID_CHAMBER_FEEDFORWARD
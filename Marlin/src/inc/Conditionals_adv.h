@@ -94,6 +94,8 @@
   #undef AUTOTEMP
   #undef PID_EXTRUSION_SCALING
   #undef LIN_ADVANCE
+  #undef LIN_ADVANCE_NONLINEAR
+  #undef LIN_ADVANCE_CALIBRATION
   #undef FILAMENT_RUNOUT_SENSOR
   #undef ADVANCED_PAUSE_FEATURE
   #undef FILAMENT_RUNOUT_DISTANCE_MM
@@ -910,6 +912,12 @@
   #endif
 #endif
 
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+  #define ADC_FILTER_AVERAGE 1
+  #define ADC_FILTER_MEDIAN  2
+  #define ADC_FILTER_IIR     3
+#endif
+
 // Remove unused STEALTHCHOP flags
 #if NUM_AXES < 9
   #undef STEALTHCHOP_W
@@ -1021,6 +1029,26 @@
   #define HAS_MEATPACK 1
 #endif
 
+// Packed G-code frames start with a byte that never occurs in UTF-8 text
+#if ENABLED(PACKED_GCODE)
+  #define PACKED_GCODE_SYNC 0xF5
+  #define PACKED_GCODE_MAX_SIZE ((MAX_CMD_SIZE) - 4)
+#endif
+
+// Plate wells are also cancelable objects
+#if ENABLED(CANCEL_OBJECTS)
+  #if ENABLED(WELL_PLATE_ARRAY) && WELL_PLATE_MAX_WELLS > 32
+    #define CANCEL_OBJECTS_MAX WELL_PLATE_MAX_WELLS
+  #else
+    #define CANCEL_OBJECTS_MAX 32
+  #endif
+#endif
+
+// Queue slots may hold a command word followed by float values
+#if EITHER(PACKED_GCODE, GCODE_PREPARSE)
+  #define HAS_PACKED_COMMANDS 1
+#endif
+
 // AVR are (usually) too limited in resources to store the configuration into the binary
 #if ENABLED(CONFIGURATION_EMBEDDING) && !defined(FORCE_CONFIG_EMBED) && (defined(__AVR__) || DISABLED(SDSUPPORT) || EITHER(SDCARD_READONLY, DISABLE_M503))
   #undef CONFIGURATION_EMBEDDING
@@ -1268,6 +1268,249 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+/**
+ * Jerk-Limited Acceleration
+ */
+#if ENABLED(JERK_LIMITED_ACCELERATION)
+  #if ENABLED(S_CURVE_ACCELERATION)
+    #error "JERK_LIMITED_ACCELERATION and S_CURVE_ACCELERATION are mutually exclusive."
+  #elif !defined(ACCELERATION_JERK)
+    #error "JERK_LIMITED_ACCELERATION requires ACCELERATION_JERK."
+  #else
+    static_assert(ACCELERATION_JERK > 0, "ACCELERATION_JERK must be greater than 0.");
+  #endif
+#endif
+
+/**
+ * SD read-ahead
+ */
+#if ENABLED(SD_READ_AHEAD) && !WITHIN(SD_READ_AHEAD_BLOCKS, 2, 32)
+  #error "SD_READ_AHEAD_BLOCKS must be from 2 to 32."
+#endif
+
+/**
+ * M808 loop cache
+ */
+#if ENABLED(GCODE_REPEAT_CACHE) && !WITHIN(GCODE_REPEAT_CACHE_SIZE, 256, 65535)
+  #error "GCODE_REPEAT_CACHE_SIZE must be from 256 to 65535."
+#endif
+
+/**
+ * Well plate arrays
+ */
+#if ENABLED(WELL_PLATE_ARRAY)
+  #if DISABLED(SDSUPPORT)
+    #error "WELL_PLATE_ARRAY requires SDSUPPORT."
+  #elif ENABLED(NO_WORKSPACE_OFFSETS)
+    #error "WELL_PLATE_ARRAY requires workspace offsets. Disable NO_WORKSPACE_OFFSETS."
+  #elif !WITHIN(WELL_PLATE_MAX_WELLS, 1, 127)
+    #error "WELL_PLATE_MAX_WELLS must be from 1 to 127."
+  #endif
+#endif
+
+/**
+ * Windowed serial flow control
+ */
+#if ENABLED(SERIAL_FLOW_WINDOW)
+  #ifndef SERIAL_FLOW_WINDOW_RX_LINES
+    #error "SERIAL_FLOW_WINDOW requires SERIAL_FLOW_WINDOW_RX_LINES."
+  #elif SERIAL_FLOW_WINDOW_RX_LINES < 0
+    #error "SERIAL_FLOW_WINDOW_RX_LINES must be 0 or more."
+  #endif
+#endif
+
+/**
+ * Packed G-code frames
+ */
+#if ENABLED(PACKED_GCODE)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "PACKED_GCODE requires FASTER_GCODE_PARSER."
+  #elif HAS_MEATPACK
+    #error "PACKED_GCODE can't be used with MEATPACK_ON_SERIAL_PORT_*."
+  #elif MAX_CMD_SIZE > 128
+    #error "PACKED_GCODE requires a MAX_CMD_SIZE of 128 or less."
+  #endif
+#endif
+#if ENABLED(GCODE_PREPARSE) && DISABLED(FASTER_GCODE_PARSER)
+  #error "GCODE_PREPARSE requires FASTER_GCODE_PARSER."
+#endif
+
+/**
+ * SD line index
+ */
+#if ENABLED(SD_LINE_INDEX)
+  #if !defined(SD_INDEX_SIZE) || !defined(SD_INDEX_LAYER_MARKER)
+    #error "SD_LINE_INDEX requires SD_INDEX_SIZE and SD_INDEX_LAYER_MARKER."
+  #elif !WITHIN(SD_INDEX_SIZE, 16, 4096) || (SD_INDEX_SIZE) & 1
+    #error "SD_INDEX_SIZE must be an even number from 16 to 4096."
+  #endif
+#endif
+
+/**
+ * SD telemetry log
+ */
+#if ENABLED(SD_LOG)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_LOG requires SDSUPPORT."
+  #elif ENABLED(SDCARD_READONLY)
+    #error "SD_LOG can't be used with SDCARD_READONLY."
+  #elif !WITHIN(SD_LOG_INTERVAL, 10, 60000)
+    #error "SD_LOG_INTERVAL must be from 10 to 60000."
+  #elif SD_LOG_SYNC_BLOCKS < 1
+    #error "SD_LOG_SYNC_BLOCKS must be 1 or more."
+  #endif
+#endif
+
+/**
+ * Fine thermistor tables
+ */
+#if ENABLED(THERMISTOR_FINE_TABLES)
+  #ifdef __AVR__
+    #error "THERMISTOR_FINE_TABLES requires a 32-bit board."
+  #elif !WITHIN(THERMISTOR_FINE_TABLE_BITS, 6, 12)
+    #error "THERMISTOR_FINE_TABLE_BITS must be from 6 to 12."
+  #endif
+#endif
+
+/**
+ * PID control loops
+ */
+#if ENABLED(PID_CONTROL_LOOPS)
+  #if ENABLED(MPCTEMP)
+    #error "PID_CONTROL_LOOPS doesn't apply to MPCTEMP hotends."
+  #elif ENABLED(PIDTEMPBED) && !(WITHIN(BED_PID_PERIOD, 0, 40000) && WITHIN(BED_PID_FILTER, 0, 7))
+    #error "BED_PID_PERIOD must be 0-40000 and BED_PID_FILTER 0-7."
+  #elif ENABLED(PIDTEMPCHAMBER) && !(WITHIN(CHAMBER_PID_PERIOD, 0, 40000) && WITHIN(CHAMBER_PID_FILTER, 0, 7))
+    #error "CHAMBER_PID_PERIOD must be 0-40000 and CHAMBER_PID_FILTER 0-7."
+  #endif
+#endif
+
+/**
+ * Continuous ADC scan
+ */
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+  #if !defined(HAL_STM32) && !defined(__PLAT_LINUX__)
+    #error "ADC_CONTINUOUS_SCAN requires an STM32 board."
+  #elif !WITHIN(ADC_SCAN_SAMPLES, 2, 64)
+    #error "ADC_SCAN_SAMPLES must be from 2 to 64."
+  #elif ADC_SCAN_FILTER != ADC_FILTER_AVERAGE && ADC_SCAN_FILTER != ADC_FILTER_MEDIAN && ADC_SCAN_FILTER != ADC_FILTER_IIR
+    #error "ADC_SCAN_FILTER must be ADC_FILTER_AVERAGE, ADC_FILTER_MEDIAN or ADC_FILTER_IIR."
+  #elif ADC_SCAN_FILTER == ADC_FILTER_IIR && !WITHIN(ADC_SCAN_IIR_SHIFT, 1, 8)
+    #error "ADC_SCAN_IIR_SHIFT must be from 1 to 8."
+  #endif
+#endif
+
+/**
+ * Temperature history
+ */
+#if ENABLED(TEMP_HISTORY)
+  #if !WITHIN(TEMP_HISTORY_INTERVAL, 1, 3600)
+    #error "TEMP_HISTORY_INTERVAL must be from 1 to 3600."
+  #elif TEMP_HISTORY_SAMPLES < 2
+    #error "TEMP_HISTORY_SAMPLES must be 2 or more."
+  #endif
+#endif
+
+/**
+ * Chamber feed-forward
+ */
+#if ENABLED(PID_CHAMBER_FEEDFORWARD)
+  #if !HAS_TEMP_CHAMBER
+    #error "PID_CHAMBER_FEEDFORWARD requires a chamber temperature sensor."
+  #elif NONE(PIDTEMP, PIDTEMPBED)
+    #error "PID_CHAMBER_FEEDFORWARD requires PIDTEMP or PIDTEMPBED."
+  #elif !WITHIN(CHAMBER_FF_SETTLE_TIME, 0, 3600)
+    #error "CHAMBER_FF_SETTLE_TIME must be from 0 to 3600."
+  #elif !WITHIN(CHAMBER_FF_LEARN_SHIFT, 1, 16)
+    #error "CHAMBER_FF_LEARN_SHIFT must be from 1 to 16."
+  #endif
+  static_assert(CHAMBER_FF_SETTLE_BAND > 0, "CHAMBER_FF_SETTLE_BAND must be above 0.");
+  static_assert(CHAMBER_FF_MIN_DELTA >= 0, "CHAMBER_FF_MIN_DELTA must be 0 or more.");
+#endif
+
+/**
+ * Multi-zone wait
+ */
+#if ENABLED(MULTI_ZONE_WAIT) && !(HAS_HOTEND || HAS_HEATED_BED || HAS_HEATED_CHAMBER)
+  #error "MULTI_ZONE_WAIT requires a hotend, heated bed or heated chamber."
+#endif
+
+/**
+ * Step response autotune
+ */
+#if ENABLED(PID_STEP_AUTOTUNE)
+  #if !HAS_PID_HEATING
+    #error "PID_STEP_AUTOTUNE requires PIDTEMP, PIDTEMPBED or PIDTEMPCHAMBER."
+  #elif !WITHIN(PID_STEP_AUTOTUNE_POWER, 10, 100)
+    #error "PID_STEP_AUTOTUNE_POWER must be from 10 to 100."
+  #elif !WITHIN(PID_STEP_AUTOTUNE_CONFIDENCE, 1, 50)
+    #error "PID_STEP_AUTOTUNE_CONFIDENCE must be from 1 to 50."
+  #elif !WITHIN(PID_STEP_AUTOTUNE_TIMEOUT, 1, 240)
+    #error "PID_STEP_AUTOTUNE_TIMEOUT must be from 1 to 240."
+  #endif
+#endif
+
+/**
+ * Syringe load monitor
+ */
+#if ENABLED(SYRINGE_MONITOR)
+  #if !AXIS_DRIVER_TYPE_E0(TMC2209)
+    #error "SYRINGE_MONITOR requires E0_DRIVER_TYPE TMC2209."
+  #elif DISABLED(STEALTHCHOP_E)
+    #error "SYRINGE_MONITOR requires STEALTHCHOP_E. StallGuard on the TMC2209 only works in StealthChop."
+  #elif !WITHIN(SYRINGE_MONITOR_CLOG, 1, 99)
+    #error "SYRINGE_MONITOR_CLOG must be from 1 to 99."
+  #elif !WITHIN(SYRINGE_MONITOR_EMPTY, 1, 250)
+    #error "SYRINGE_MONITOR_EMPTY must be from 1 to 250."
+  #elif !WITHIN(SYRINGE_MONITOR_LEARN, 1, 255)
+    #error "SYRINGE_MONITOR_LEARN must be from 1 to 255."
+  #elif !WITHIN(SYRINGE_MONITOR_SHIFT, 0, 10)
+    #error "SYRINGE_MONITOR_SHIFT must be from 0 to 10."
+  #endif
+#endif
+
+/**
+ * Syringe volume
+ */
+#if ENABLED(SYRINGE_VOLUME)
+  #if !HAS_EXTRUDERS
+    #error "SYRINGE_VOLUME requires EXTRUDERS."
+  #elif !HAS_RESUME_CONTINUE
+    #error "SYRINGE_VOLUME requires an LCD display, HOST_PROMPT_SUPPORT, or EMERGENCY_PARSER."
+  #endif
+  static_assert(SYRINGE_REFILL_MARGIN >= 0, "SYRINGE_REFILL_MARGIN must be 0 or more.");
+  static_assert(SYRINGE_REFILL_Z_RAISE >= 0, "SYRINGE_REFILL_Z_RAISE must be 0 or more.");
+#endif
+
+/**
+ * Arc segmentation by chordal error
+ */
+#ifdef ARC_MAX_CHORDAL_ERROR
+  #if DISABLED(ARC_SUPPORT)
+    #error "ARC_MAX_CHORDAL_ERROR requires ARC_SUPPORT."
+  #else
+    static_assert(ARC_MAX_CHORDAL_ERROR > 0, "ARC_MAX_CHORDAL_ERROR must be greater than 0.");
+  #endif
+#endif
+
+/**
+ * The print time estimator is a host build
+ */
+#if ENABLED(PRINT_TIME_ESTIMATOR) && !defined(__PLAT_LINUX__)
+  #error "PRINT_TIME_ESTIMATOR requires the LINUX native HAL. Build with 'buildroot/bin/build_estimator'."
+#endif
+
+/**
+ * ISR cycle stats require a HAL cycle counter
+ */
+#if ENABLED(ISR_CYCLE_STATS)
+  #ifndef HAL_CYCLE_COUNTER
+    #error "ISR_CYCLE_STATS requires a HAL with a cycle counter (e.g., STM32 with DWT, or LINUX)."
+  #elif !WITHIN(ISR_CYCLE_STATS_MARGIN, 0, 400)
+    #error "ISR_CYCLE_STATS_MARGIN must be between 0 and 400 (percent)."
+  #endif
+#endif
+
 /**
  * Linear Advance 1.5 - Check K value range
  */
@@ -1276,8 +1519,13 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     WITHIN(LIN_ADVANCE_K, 0, 10),
     "LIN_ADVANCE_K must be a value from 0 to 10 (Changed in LIN_ADVANCE v1.5, Marlin 1.1.9)."
   );
+  #if ENABLED(LIN_ADVANCE_NONLINEAR)
+    static_assert(WITHIN(LIN_ADVANCE_K2, 0, 10), "LIN_ADVANCE_K2 must be a value from 0 to 10.");
+  #endif
   #if ENABLED(S_CURVE_ACCELERATION) && DISABLED(EXPERIMENTAL_SCURVE)
     #error "LIN_ADVANCE and S_CURVE_ACCELERATION may not play well together! Enable EXPERIMENTAL_SCURVE to continue."
+  #elif ENABLED(JERK_LIMITED_ACCELERATION) && DISABLED(EXPERIMENTAL_SCURVE)
+    #error "LIN_ADVANCE and JERK_LIMITED_ACCELERATION may not play well together! Enable EXPERIMENTAL_SCURVE to continue."
   #elif ENABLED(DIRECT_STEPPING)
     #error "DIRECT_STEPPING is incompatible with LIN_ADVANCE. Enable in external planner if possible."
   #elif NONE(HAS_JUNCTION_DEVIATION, ALLOW_LOW_EJERK) && defined(DEFAULT_EJERK)
@@ -29,7 +29,7 @@ using namespace FTDI;
 using namespace Theme;
 
 #define GRID_COLS 2
-#define GRID_ROWS 10
+#define GRID_ROWS TERN(TEMP_HISTORY, 11, 10)
 
 void MainMenu::onRedraw(draw_mode_t what) {
 
@@ -54,8 +54,11 @@ void MainMenu::onRedraw(draw_mode_t what) {
        .tag(7).button(BTN_POS(1,7), BTN_SIZE(2,1), GET_TEXT_F(MSG_INTERFACE))
        .tag(8).button(BTN_POS(1,8), BTN_SIZE(2,1), GET_TEXT_F(MSG_ADVANCED_SETTINGS))
        .tag(9).button(BTN_POS(1,9), BTN_SIZE(2,1), GET_TEXT_F(MSG_INFO_MENU))
+       #if ENABLED(TEMP_HISTORY)
+         .tag(10).button(BTN_POS(1,10), BTN_SIZE(2,1), GET_TEXT_F(MSG_TEMP_HISTORY))
+       #endif
        .colors(action_btn)
-       .tag(1).button(BTN_POS(1,10), BTN_SIZE(2,1), GET_TEXT_F(MSG_BUTTON_DONE));
+       .tag(1).button(BTN_POS(1,GRID_ROWS), BTN_SIZE(2,1), GET_TEXT_F(MSG_BUTTON_DONE));
   }
 }
 
@@ -76,6 +79,9 @@ bool MainMenu::onTouchEnd(uint8_t tag) {
     case 7: GOTO_SCREEN(InterfaceSettingsScreen);                                    break;
     case 8: GOTO_SCREEN(AdvancedSettingsMenu);                                       break;
     case 9: GOTO_SCREEN(AboutScreen);                                                break;
+    #if ENABLED(TEMP_HISTORY)
+    case 10: GOTO_SCREEN(TemperatureHistoryScreen);                                  break;
+    #endif
     default:
       return false;
   }
@@ -103,3 +103,7 @@ enum {
 #include "printing_dialog_box.h"
 #include "confirm_home_xyz.h"
 #include "confirm_home_e.h"
+
+#if ENABLED(TEMP_HISTORY)
+  #include "../generic/temperature_history_screen.h"
+#endif
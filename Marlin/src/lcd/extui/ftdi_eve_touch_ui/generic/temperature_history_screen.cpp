@@ -0,0 +1,131 @@
+/**********************************
+ * temperature_history_screen.cpp *
+ **********************************/
+
+/****************************************************************************
+ *   This program is free software: you can redistribute it and/or modify   *
+ *   it under the terms of the GNU General Public License as published by   *
+ *   the Free Software Foundation, either version 3 of the License, or      *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   This program is distributed in the hope that it will be useful,        *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU General Public License for more details.                           *
+ *                                                                          *
+ *   To view a copy of the GNU General Public License, go to the following  *
+ *   location: <https://www.gnu.org/licenses/>.                             *
+ ****************************************************************************/
+
+#include "../config.h"
+#include "../screens.h"
+
+#ifdef FTDI_TEMPERATURE_HISTORY_SCREEN
+
+#include "../../../../feature/temp_history.h"
+
+using namespace FTDI;
+using namespace Theme;
+
+#define GRID_COLS 4
+#define GRID_ROWS 8
+
+// Drawing more points than this only adds to the display list
+#define MAX_POINTS 100
+
+static constexpr uint32_t channel_rgb[] = { 0xFF4040, 0x40A0FF, 0xFFC020, 0x40D040, 0xD060FF, 0x40E0E0, 0xFF80C0, 0xC0C0C0 };
+
+// The label used by M105 for each channel
+static void channel_label(char *str, const heater_id_t id) {
+  switch (id) {
+    case H_BED:       strcpy_P(str, PSTR("B")); break;
+    case H_CHAMBER:   strcpy_P(str, PSTR("C")); break;
+    case H_PROBE:     strcpy_P(str, PSTR("P")); break;
+    case H_COOLER:    strcpy_P(str, PSTR("L")); break;
+    case H_BOARD:     strcpy_P(str, PSTR("M")); break;
+    case H_REDUNDANT: strcpy_P(str, PSTR("R")); break;
+    default: str[0] = 'T'; str[1] = '0' + id; str[2] = '\0'; break;
+  }
+}
+
+void TemperatureHistoryScreen::draw_graph(CommandProcessor &cmd, int16_t x, int16_t y, int16_t w, int16_t h) {
+  const uint16_t n = temp_history.count();
+  if (n < 2) return;
+
+  const uint16_t stride = (n + MAX_POINTS - 1) / MAX_POINTS;
+
+  int16_t low = INT16_MAX, high = INT16_MIN;
+  for (uint16_t i = 0; i < n; i += stride)
+    LOOP_L_N(c, TEMP_HISTORY_CHANNELS) {
+      const int16_t t = temp_history.get(i).value[c].mean;
+      NOMORE(low, t); NOLESS(high, t);
+    }
+  if (high - low < 10) { low -= 5; high += 5; }
+
+  // Range labels, top and bottom left
+  char str[15];
+  cmd.cmd(COLOR_RGB(bg_text_enabled)).font(font_small);
+  format_temp(str, high * 0.1f);
+  cmd.text(x, y, w, h, str, OPT_CENTERY);
+  format_temp(str, low * 0.1f);
+  cmd.text(x, y + h, w, 0, str, OPT_CENTERY);
+
+  // Vertices are in 1/16 pixel
+  #define PX(I) ((x + int32_t(w) * (I) / (n - 1)) * 16)
+  #define PY(T) ((y + h - int32_t(h) * ((T) - low) / (high - low)) * 16)
+
+  cmd.cmd(SAVE_CONTEXT()).cmd(LINE_WIDTH(24));
+  LOOP_L_N(c, TEMP_HISTORY_CHANNELS) {
+    cmd.cmd(COLOR_RGB(channel_rgb[c % COUNT(channel_rgb)])).cmd(BEGIN(LINE_STRIP));
+    for (uint16_t i = 0; i < n; i += stride)
+      cmd.cmd(VERTEX2F(PX(i), PY(temp_history.get(i).value[c].mean)));
+    if ((n - 1) % stride)
+      cmd.cmd(VERTEX2F(PX(n - 1), PY(temp_history.get(n - 1).value[c].mean)));
+  }
+  cmd.cmd(END()).cmd(RESTORE_CONTEXT());
+}
+
+void TemperatureHistoryScreen::onRedraw(draw_mode_t) {
+  CommandProcessor cmd;
+  cmd.cmd(CLEAR_COLOR_RGB(bg_color))
+     .cmd(COLOR_RGB(bg_text_enabled))
+     .cmd(CLEAR(true,true,true))
+     .tag(0);
+
+  cmd.font(font_medium)
+     .text(BTN_POS(1,1), BTN_SIZE(4,1), GET_TEXT_F(MSG_TEMP_HISTORY));
+
+  draw_graph(cmd, BTN_POS(1,2), BTN_SIZE(4,5));
+
+  // Legend
+  cmd.font(font_small);
+  LOOP_L_N(c, TEMP_HISTORY_CHANNELS) {
+    char str[3];
+    channel_label(str, temp_history.channel_id[c]);
+    const int16_t lw = BTN_W(4) / (TEMP_HISTORY_CHANNELS);
+    cmd.cmd(COLOR_RGB(channel_rgb[c % COUNT(channel_rgb)]))
+       .text(BTN_X(1) + lw * c, BTN_Y(7), lw, BTN_H(1), str);
+  }
+
+  cmd.font(font_medium)
+     .colors(action_btn)
+     .tag(1).button(BTN_POS(1,8), BTN_SIZE(4,1), GET_TEXT_F(MSG_BUTTON_DONE));
+}
+
+bool TemperatureHistoryScreen::onTouchEnd(uint8_t tag) {
+  switch (tag) {
+    case 1: GOTO_PREVIOUS(); break;
+    default: return false;
+  }
+  return true;
+}
+
+void TemperatureHistoryScreen::onIdle() {
+  if (refresh_timer.elapsed(STATUS_UPDATE_INTERVAL)) {
+    onRefresh();
+    refresh_timer.start();
+  }
+  BaseScreen::onIdle();
+}
+
+#endif // FTDI_TEMPERATURE_HISTORY_SCREEN
@@ -91,6 +91,7 @@ SCREEN_TABLE {
   DECL_SCREEN_IF_INCLUDED(FTDI_FILAMENT_RUNOUT_SCREEN)
   DECL_SCREEN_IF_INCLUDED(FTDI_LINEAR_ADVANCE_SCREEN)
   DECL_SCREEN_IF_INCLUDED(FTDI_TEMPERATURE_SCREEN)
+  DECL_SCREEN_IF_INCLUDED(FTDI_TEMPERATURE_HISTORY_SCREEN)
   DECL_SCREEN_IF_INCLUDED(FTDI_CHANGE_FILAMENT_SCREEN)
   DECL_SCREEN_IF_INCLUDED(FTDI_INTERFACE_SETTINGS_SCREEN)
   DECL_SCREEN_IF_INCLUDED(FTDI_INTERFACE_SOUNDS_SCREEN)
@@ -107,6 +107,14 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+  #include "../feature/print_time_estimator.h"
+#endif
+
+#if ENABLED(SYRINGE_VOLUME)
+  #include "../feature/syringe_volume.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_FOR_1ST_MOVE 100
@@ -143,6 +151,10 @@ float Planner::mm_per_step[DISTINCT_AXES];      // (mm) Millimeters per step
   #endif
 #endif
 
+#if ENABLED(JERK_LIMITED_ACCELERATION)
+  float Planner::acceleration_jerk;             // (mm/s^3) M205 K
+#endif
+
 #if HAS_CLASSIC_JERK
   TERN(HAS_LINEAR_E_JERK, xyz_pos_t, xyze_pos_t) Planner::max_jerk;
 #endif
@@ -220,6 +232,9 @@ float Planner::previous_nominal_speed_sqr;
 
 #if ENABLED(LIN_ADVANCE)
   float Planner::extruder_advance_K[EXTRUDERS]; // Initialized by settings.load()
+  #if ENABLED(LIN_ADVANCE_NONLINEAR)
+    float Planner::extruder_advance_K2[EXTRUDERS]; // Initialized by settings.load()
+  #endif
 #endif
 
 #if HAS_POSITION_FLOAT
@@ -786,6 +801,56 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
 
   const int32_t accel = block->acceleration_steps_per_s2;
 
+  #if ENABLED(JERK_LIMITED_ACCELERATION)
+
+    // Jerk in steps/s^3, in proportion to the acceleration
+    const float jerk = accel * acceleration_jerk / block->acceleration;
+
+    // Jerk too high for jerk_rate to hold is as good as infinite, so take
+    // the block as a plain trapezoid rather than clamp a profile the
+    // Stepper would then run differently from the one timed here.
+    constexpr float jerk_rate_scale = 0.5f * (float(1ULL << 48) / sq(float(STEPPER_TIMER_RATE)));
+    const bool trapezoid = jerk * jerk_rate_scale > float(UINT32_MAX);
+
+    auto ramp_time = [&](const_float_t dv) { return trapezoid ? dv / accel : jerk_ramp_time(dv, accel, jerk); };
+    auto ramp_steps = [&](const_float_t v0, const_float_t v1) { return (v0 + v1) * 0.5f * ramp_time(ABS(v1 - v0)); };
+
+    // Steps required for acceleration, deceleration to/from nominal rate
+    float cruise_rate = block->nominal_rate;
+    uint32_t accelerate_steps = CEIL(ramp_steps(initial_rate, cruise_rate)),
+             decelerate_steps = FLOOR(ramp_steps(cruise_rate, final_rate));
+    int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
+
+    // Without a plateau the peak rate has no closed form, so bisect for
+    // the rate where both ramps together take the whole block.
+    if (plateau_steps < 0) {
+      float lo = _MAX(initial_rate, final_rate), hi = cruise_rate;
+      LOOP_L_N(i, 12) {
+        const float mid = (lo + hi) * 0.5f;
+        if (ramp_steps(initial_rate, mid) + ramp_steps(mid, final_rate) > block->step_event_count) hi = mid; else lo = mid;
+      }
+      cruise_rate = lo;
+      decelerate_steps = _MIN(uint32_t(FLOOR(ramp_steps(cruise_rate, final_rate))), block->step_event_count);
+      accelerate_steps = block->step_event_count - decelerate_steps;
+      plateau_steps = 0;
+    }
+
+    // Ramp times, jerk times and peak accelerations for the Stepper ISR
+    // A trapezoid has no jerk time, so the Stepper ramps linearly at the peak rate.
+    auto set_ramp = [&](const_float_t dv, uint32_t &ramp_ticks, uint32_t &jerk_ticks, uint32_t &peak_rate) {
+      const bool full = trapezoid || dv * jerk >= sq(accel);
+      const float jt = trapezoid ? 0 : full ? accel / jerk : SQRT(dv / jerk);
+      ramp_ticks = ramp_time(dv) * (STEPPER_TIMER_RATE);
+      jerk_ticks = jt * (STEPPER_TIMER_RATE);
+      peak_rate = (full ? accel : jerk * jt) * (sq(4096.0f) / (STEPPER_TIMER_RATE));
+    };
+    set_ramp(cruise_rate - initial_rate, block->acceleration_time, block->accel_jerk_time, block->accel_peak_rate);
+    set_ramp(cruise_rate - final_rate, block->deceleration_time, block->decel_jerk_time, block->decel_peak_rate);
+    block->jerk_rate = trapezoid ? 0 : uint32_t(jerk * jerk_rate_scale);
+    block->cruise_rate = cruise_rate;
+
+  #else
+
           // Steps required for acceleration, deceleration to/from nominal rate
   uint32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
            decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
@@ -811,6 +876,8 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
       cruise_rate = block->nominal_rate;
   #endif
 
+  #endif // !JERK_LIMITED_ACCELERATION
+
   #if ENABLED(S_CURVE_ACCELERATION)
     // Jerk controlled speed requires to express speed versus time, NOT steps
     uint32_t acceleration_time = ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
@@ -1181,9 +1248,8 @@ void Planner::recalculate_trapezoids() {
             calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
             #if ENABLED(LIN_ADVANCE)
               if (block->use_advance_lead) {
-                const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
-                block->max_adv_steps = current_nominal_speed * comp;
-                block->final_adv_steps = next_entry_speed * comp;
+                block->max_adv_steps = advance_steps_for(block, current_nominal_speed);
+                block->final_adv_steps = advance_steps_for(block, next_entry_speed);
               }
             #endif
           }
@@ -1220,9 +1286,8 @@ void Planner::recalculate_trapezoids() {
       calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
       #if ENABLED(LIN_ADVANCE)
         if (next->use_advance_lead) {
-          const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
-          next->max_adv_steps = next_nominal_speed * comp;
-          next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
+          next->max_adv_steps = advance_steps_for(next, next_nominal_speed);
+          next->final_adv_steps = advance_steps_for(next, MINIMUM_PLANNER_SPEED);
         }
       #endif
     }
@@ -1777,7 +1842,10 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
 /**
  * Block until the planner is finished processing
  */
-void Planner::synchronize() { while (busy()) idle(); }
+void Planner::synchronize() {
+  TERN_(PRINT_TIME_ESTIMATOR, estimator.drain());
+  while (busy()) idle();
+}
 
 /**
  * Planner::_buffer_steps
@@ -1996,6 +2064,8 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   // Set direction bits
   block->direction_bits = dm;
 
+  TERN_(PRINT_TIME_ESTIMATOR, block->layer_z = estimator.planned_z);
+
   // Update block laser power
   #if ENABLED(LASER_POWER_INLINE)
     laser_inline.status.isPlanned = true;
@@ -2086,6 +2156,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   TERN_(HAS_EXTRUDERS, steps_dist_mm.e = esteps_float * mm_per_step[E_AXIS_N(extruder)]);
 
   TERN_(LCD_SHOW_E_TOTAL, e_move_accumulator += steps_dist_mm.e);
+  TERN_(SYRINGE_VOLUME, syringe_volume.consume(extruder, steps_dist_mm.e));
 
   #if BOTH(HAS_ROTATIONAL_AXES, INCH_MODE_SUPPORT)
     bool cartesian_move = true;
@@ -2464,6 +2535,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   // Compute and limit the acceleration rate for the trapezoid generator.
   const float steps_per_mm = block->step_event_count * inverse_millimeters;
   uint32_t accel;
+  #if ENABLED(LIN_ADVANCE)
+    float advance_K = 0;  // Effective advance factor for this block (mm per mm/s)
+  #endif
   if (NUM_AXIS_GANG(
          !block->steps.a, && !block->steps.b, && !block->steps.c,
       && !block->steps.i, && !block->steps.j, && !block->steps.k,
@@ -2499,12 +2573,12 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
        *
        * esteps             : This is a print move, because we checked for A, B, C steps before.
        *
-       * extruder_advance_K[active_extruder] : There is an advance factor set for this extruder.
+       * has_advance(extruder) : There is an advance factor set for this extruder.
        *
        * de > 0             : Extruder is running forward (e.g., for "Wipe while retracting" (Slic3r) or "Combing" (Cura) moves)
        */
       block->use_advance_lead =  esteps
-                              && extruder_advance_K[active_extruder]
+                              && has_advance(extruder)
                               && de > 0;
 
       if (block->use_advance_lead) {
@@ -2523,7 +2597,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
         if (block->e_D_ratio > 3.0f)
           block->use_advance_lead = false;
         else {
-          const uint32_t max_accel_steps_per_s2 = MAX_E_JERK(extruder) / (extruder_advance_K[active_extruder] * block->e_D_ratio) * steps_per_mm;
+          // With a nonlinear term the advance curve is steepest at nominal speed, so limit acceleration there
+          advance_K = advance_K_at(extruder, block->e_D_ratio * SQRT(block->nominal_speed_sqr));
+          const uint32_t max_accel_steps_per_s2 = MAX_E_JERK(extruder) / (advance_K * block->e_D_ratio) * steps_per_mm;
           if (TERN0(LA_DEBUG, accel > max_accel_steps_per_s2))
             SERIAL_ECHOLNPGM("Acceleration limited.");
           NOMORE(accel, max_accel_steps_per_s2);
@@ -2568,9 +2644,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   #endif
   #if ENABLED(LIN_ADVANCE)
     if (block->use_advance_lead) {
-      block->advance_speed = (STEPPER_TIMER_RATE) / (extruder_advance_K[active_extruder] * block->e_D_ratio * block->acceleration * settings.axis_steps_per_mm[E_AXIS_N(extruder)]);
+      block->advance_speed = (STEPPER_TIMER_RATE) / (advance_K * block->e_D_ratio * block->acceleration * settings.axis_steps_per_mm[E_AXIS_N(extruder)]);
       #if ENABLED(LA_DEBUG)
-        if (extruder_advance_K[active_extruder] * block->e_D_ratio * block->acceleration * 2 < SQRT(block->nominal_speed_sqr) * block->e_D_ratio)
+        if (advance_K * block->e_D_ratio * block->acceleration * 2 < SQRT(block->nominal_speed_sqr) * block->e_D_ratio)
           SERIAL_ECHOLNPGM("More than 2 steps per eISR loop executed.");
         if (block->advance_speed < 200)
           SERIAL_ECHOLNPGM("eISR running at > 10kHz.");
@@ -3103,6 +3179,8 @@ bool Planner::buffer_segment(const abce_pos_t &abce
 bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder/*=active_extruder*/, const float millimeters/*=0.0*/
   OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration/*=0.0*/)
 ) {
+  TERN_(PRINT_TIME_ESTIMATOR, estimator.planned_z = cart.z);
+
   xyze_pos_t machine = cart;
   TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
 
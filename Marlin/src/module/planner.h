@@ -207,6 +207,17 @@ typedef struct block_t {
     uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
   #endif
 
+  #if ENABLED(JERK_LIMITED_ACCELERATION)
+    uint32_t cruise_rate,                   // The rate reached at the end of acceleration
+             jerk_rate,                     // Half the jerk as rate change per squared STEP timer count, scaled by 2^48
+             acceleration_time,             // Acceleration time and deceleration time in STEP timer counts
+             deceleration_time,
+             accel_jerk_time,               // Time spent raising and lowering acceleration at each end of the ramps
+             decel_jerk_time,
+             accel_peak_rate,               // Peak acceleration of each ramp, scaled like acceleration_rate
+             decel_peak_rate;
+  #endif
+
   axis_bits_t direction_bits;               // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
 
   // Advance extrusion
@@ -252,6 +263,10 @@ typedef struct block_t {
     block_laser_t laser;
   #endif
 
+  #if ENABLED(PRINT_TIME_ESTIMATOR)
+    float layer_z;                          // Unleveled Z for per-layer estimates
+  #endif
+
 } block_t;
 
 #if ANY(LIN_ADVANCE, SCARA_FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL, POWER_LOSS_RECOVERY)
@@ -389,6 +404,10 @@ class Planner {
       #endif
     #endif
 
+    #if ENABLED(JERK_LIMITED_ACCELERATION)
+      static float acceleration_jerk;                 // (mm/s^3) M205 K
+    #endif
+
     #if HAS_CLASSIC_JERK
       // (mm/s^2) M205 XYZ(E) - The largest speed change requiring no acceleration.
       static TERN(HAS_LINEAR_E_JERK, xyz_pos_t, xyze_pos_t) max_jerk;
@@ -408,6 +427,9 @@ class Planner {
 
     #if ENABLED(LIN_ADVANCE)
       static float extruder_advance_K[EXTRUDERS];
+      #if ENABLED(LIN_ADVANCE_NONLINEAR)
+        static float extruder_advance_K2[EXTRUDERS];
+      #endif
     #endif
 
     /**
@@ -979,9 +1001,49 @@ class Planner {
      * 'distance'.
      */
     static float max_allowable_speed_sqr(const_float_t accel, const_float_t target_velocity_sqr, const_float_t distance) {
-      return target_velocity_sqr - 2 * accel * distance;
+      #if ENABLED(JERK_LIMITED_ACCELERATION)
+        return sq(jerk_limited_speed(SQRT(target_velocity_sqr), ABS(accel), acceleration_jerk, distance));
+      #else
+        return target_velocity_sqr - 2 * accel * distance;
+      #endif
     }
 
+    #if ENABLED(JERK_LIMITED_ACCELERATION)
+      /**
+       * Time to change speed by 'dv' ramping acceleration up and down at 'jerk'.
+       * Acceleration is held at 'accel' in between if the change is large enough.
+       */
+      static float jerk_ramp_time(const_float_t dv, const_float_t accel, const_float_t jerk) {
+        return dv * jerk >= sq(accel) ? dv / accel + accel / jerk : 2 * SQRT(dv / jerk);
+      }
+
+      /**
+       * Distance to go from speed 'v0' to 'v1'. The ramp is symmetric,
+       * so the average speed is halfway between the two.
+       */
+      static float jerk_ramp_distance(const_float_t v0, const_float_t v1, const_float_t accel, const_float_t jerk) {
+        return (v0 + v1) * 0.5f * jerk_ramp_time(ABS(v1 - v0), accel, jerk);
+      }
+
+      /**
+       * The highest speed that can change to speed 'v' within 'distance'.
+       * Solved directly from jerk_ramp_distance():
+       *  - With constant acceleration: a quadratic in the speed change.
+       *  - Without: a depressed cubic in the root of the speed change.
+       */
+      static float jerk_limited_speed(const_float_t v, const_float_t accel, const_float_t jerk, const_float_t distance) {
+        const float dv_full = sq(accel) / jerk;   // Smallest speed change that reaches full acceleration
+        if (distance >= jerk_ramp_distance(v, v + dv_full, accel, jerk)) {
+          const float b = v / accel + accel / (2 * jerk), c = v * accel / jerk - distance;
+          return v + accel * (SQRT(sq(b) - 2 * c / accel) - b);
+        }
+        const float p = 2 * v, q = distance * SQRT(jerk),
+                    r = SQRT(sq(q) * 0.25f + p * p * p / 27),
+                    s = cbrtf(q * 0.5f + r) + cbrtf(q * 0.5f - r);
+        return v + sq(s);
+      }
+    #endif
+
     #if ENABLED(S_CURVE_ACCELERATION)
       /**
        * Calculate the speed reached given initial speed, acceleration and distance
@@ -993,6 +1055,27 @@ class Planner {
 
     static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
 
+    #if ENABLED(LIN_ADVANCE)
+      // Is there any advance (linear or nonlinear) set for the given extruder?
+      FORCE_INLINE static bool has_advance(const uint8_t e) {
+        return extruder_advance_K[e] || TERN0(LIN_ADVANCE_NONLINEAR, extruder_advance_K2[e]);
+      }
+
+      // Slope of the advance curve (mm per mm/s) at the given extruder speed
+      FORCE_INLINE static float advance_K_at(const uint8_t e, const_float_t e_speed) {
+        return extruder_advance_K[e] + TERN0(LIN_ADVANCE_NONLINEAR, 2.0f * extruder_advance_K2[e] * e_speed);
+      }
+
+      // Advance steps that hold the nozzle pressure for the given block at the given path speed
+      FORCE_INLINE static uint16_t advance_steps_for(const block_t * const block, const_float_t speed) {
+        const uint8_t e = block->extruder;
+        const float e_speed = block->e_D_ratio * speed;
+        float adv_mm = extruder_advance_K[e] * e_speed;
+        TERN_(LIN_ADVANCE_NONLINEAR, adv_mm += extruder_advance_K2[e] * sq(e_speed));
+        return adv_mm * settings.axis_steps_per_mm[E_AXIS_N(e)];
+      }
+    #endif
+
     static void reverse_pass_kernel(block_t * const current, const block_t * const next);
     static void forward_pass_kernel(const block_t * const previous, block_t * const current, uint8_t block_index);
 
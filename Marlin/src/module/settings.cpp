@@ -36,7 +36,7 @@
  */
 
 // Change EEPROM version if the structure changes
-#define EEPROM_VERSION "V86"
+#define EEPROM_VERSION "V90"
 #define EEPROM_OFFSET 100
 
 // Check the integrity of data offsets.
@@ -96,6 +96,10 @@
 
 #include "../feature/fwretract.h"
 
+#if ENABLED(SYRINGE_VOLUME)
+  #include "../feature/syringe_volume.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
 #endif
@@ -220,6 +224,7 @@ typedef struct SettingsDataStruct {
 
   xyze_float_t planner_max_jerk;                        // M205 XYZE  planner.max_jerk
   float planner_junction_deviation_mm;                  // M205 J     planner.junction_deviation_mm
+  float planner_acceleration_jerk;                      // M205 K     planner.acceleration_jerk
 
   //
   // Home Offset
@@ -376,6 +381,14 @@ typedef struct SettingsDataStruct {
   //
   PID_t chamberPID;                                     // M309 PID / M303 E-2 U
 
+  //
+  // PID_CHAMBER_FEEDFORWARD
+  //
+  #if ENABLED(PID_CHAMBER_FEEDFORWARD)
+    float hotend_ff_Ka[HOTENDS][2];                     // M747 En A B
+    float bed_ff_Ka[2];                                 // M747 E-1 A B
+  #endif
+
   //
   // User-defined Thermistors
   //
@@ -430,6 +443,15 @@ typedef struct SettingsDataStruct {
   float planner_filament_size[EXTRUDERS];               // M200 T D  planner.filament_size[]
   float planner_volumetric_extruder_limit[EXTRUDERS];   // M200 T L  planner.volumetric_extruder_limit[]
 
+  //
+  // SYRINGE_VOLUME
+  //
+  #if ENABLED(SYRINGE_VOLUME)
+    float syringe_diameter[EXTRUDERS];                  // M921 T D
+    float syringe_capacity[EXTRUDERS];                  // M921 T C
+    float syringe_margin;                               // M921 M
+  #endif
+
   //
   // HAS_TRINAMIC_CONFIG
   //
@@ -442,6 +464,7 @@ typedef struct SettingsDataStruct {
   // LIN_ADVANCE
   //
   float planner_extruder_advance_K[_MAX(EXTRUDERS, 1)]; // M900 K  planner.extruder_advance_K
+  float planner_extruder_advance_K2[_MAX(EXTRUDERS, 1)]; // M900 Q  planner.extruder_advance_K2
 
   //
   // HAS_MOTOR_CURRENT_PWM
@@ -781,6 +804,13 @@ void MarlinSettings::postprocess() {
 
       TERN_(CLASSIC_JERK, dummyf = 0.02f);
       EEPROM_WRITE(TERN(CLASSIC_JERK, dummyf, planner.junction_deviation_mm));
+
+      #if ENABLED(JERK_LIMITED_ACCELERATION)
+        EEPROM_WRITE(planner.acceleration_jerk);
+      #else
+        dummyf = 5000;
+        EEPROM_WRITE(dummyf);
+      #endif
     }
 
     //
@@ -1112,6 +1142,18 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(chamber_pid);
     }
 
+    //
+    // PID_CHAMBER_FEEDFORWARD
+    //
+    #if ENABLED(PID_CHAMBER_FEEDFORWARD)
+    {
+      _FIELD_TEST(hotend_ff_Ka);
+      const float no_Ka[2] = { 0 };
+      HOTEND_LOOP() EEPROM_WRITE(TERN(PIDTEMP, thermalManager.temp_hotend[e].ff.Ka, no_Ka));
+      EEPROM_WRITE(TERN(PIDTEMPBED, thermalManager.temp_bed.ff.Ka, no_Ka));
+    }
+    #endif
+
     //
     // User-defined Thermistors
     //
@@ -1229,6 +1271,18 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    //
+    // Syringe Volume
+    //
+    #if ENABLED(SYRINGE_VOLUME)
+    {
+      _FIELD_TEST(syringe_diameter);
+      EEPROM_WRITE(syringe_volume.diameter);
+      EEPROM_WRITE(syringe_volume.capacity);
+      EEPROM_WRITE(syringe_volume.margin);
+    }
+    #endif
+
     //
     // TMC Configuration
     //
@@ -1420,6 +1474,15 @@ void MarlinSettings::postprocess() {
         dummyf = 0;
         for (uint8_t q = _MAX(EXTRUDERS, 1); q--;) EEPROM_WRITE(dummyf);
       #endif
+
+      _FIELD_TEST(planner_extruder_advance_K2);
+
+      #if ENABLED(LIN_ADVANCE_NONLINEAR)
+        EEPROM_WRITE(planner.extruder_advance_K2);
+      #else
+        dummyf = 0;
+        for (uint8_t q = _MAX(EXTRUDERS, 1); q--;) EEPROM_WRITE(dummyf);
+      #endif
     }
 
     //
@@ -1732,6 +1795,14 @@ void MarlinSettings::postprocess() {
         #endif
 
         EEPROM_READ(TERN(CLASSIC_JERK, dummyf, planner.junction_deviation_mm));
+
+        {
+          float accel_jerk;
+          EEPROM_READ(accel_jerk);
+          #if ENABLED(JERK_LIMITED_ACCELERATION)
+            if (!validating && accel_jerk > 0) planner.acceleration_jerk = accel_jerk;
+          #endif
+        }
       }
 
       //
@@ -2062,6 +2133,26 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      //
+      // Chamber feed-forward
+      //
+      #if ENABLED(PID_CHAMBER_FEEDFORWARD)
+      {
+        float Ka[2];
+        _FIELD_TEST(hotend_ff_Ka);
+        HOTEND_LOOP() {
+          EEPROM_READ(Ka);
+          #if ENABLED(PIDTEMP)
+            if (!validating) COPY(thermalManager.temp_hotend[e].ff.Ka, Ka);
+          #endif
+        }
+        EEPROM_READ(Ka);
+        #if ENABLED(PIDTEMPBED)
+          if (!validating) COPY(thermalManager.temp_bed.ff.Ka, Ka);
+        #endif
+      }
+      #endif
+
       //
       // User-defined Thermistors
       //
@@ -2175,6 +2266,27 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      //
+      // Syringe Volume
+      //
+      #if ENABLED(SYRINGE_VOLUME)
+      {
+        struct {
+          float diameter[EXTRUDERS];
+          float capacity[EXTRUDERS];
+          float margin;
+        } storage;
+
+        _FIELD_TEST(syringe_diameter);
+        EEPROM_READ(storage);
+        if (!validating) {
+          COPY(syringe_volume.diameter, storage.diameter);
+          COPY(syringe_volume.capacity, storage.capacity);
+          syringe_volume.margin = storage.margin;
+        }
+      }
+      #endif
+
       //
       // TMC Stepper Settings
       //
@@ -2373,6 +2485,14 @@ void MarlinSettings::postprocess() {
           if (!validating)
             COPY(planner.extruder_advance_K, extruder_advance_K);
         #endif
+
+        float extruder_advance_K2[_MAX(EXTRUDERS, 1)];
+        _FIELD_TEST(planner_extruder_advance_K2);
+        EEPROM_READ(extruder_advance_K2);
+        #if ENABLED(LIN_ADVANCE_NONLINEAR)
+          if (!validating)
+            COPY(planner.extruder_advance_K2, extruder_advance_K2);
+        #endif
       }
 
       //
@@ -2867,6 +2987,7 @@ void MarlinSettings::reset() {
   #endif
 
   TERN_(HAS_JUNCTION_DEVIATION, planner.junction_deviation_mm = float(JUNCTION_DEVIATION_MM));
+  TERN_(JERK_LIMITED_ACCELERATION, planner.acceleration_jerk = float(ACCELERATION_JERK));
 
   #if HAS_SCARA_OFFSET
     scara_home_offset.reset();
@@ -3163,6 +3284,14 @@ void MarlinSettings::reset() {
     thermalManager.temp_chamber.pid.Kd = scalePID_d(DEFAULT_chamberKd);
   #endif
 
+  //
+  // Chamber feed-forward, learned from scratch
+  //
+  #if ENABLED(PID_CHAMBER_FEEDFORWARD)
+    TERN_(PIDTEMP, HOTEND_LOOP() thermalManager.temp_hotend[e].ff = chamber_ff_t());
+    TERN_(PIDTEMPBED, thermalManager.temp_bed.ff = chamber_ff_t());
+  #endif
+
   //
   // User-Defined Thermistors
   //
@@ -3221,6 +3350,8 @@ void MarlinSettings::reset() {
     #endif
   #endif
 
+  TERN_(SYRINGE_VOLUME, syringe_volume.reset());
+
   endstops.enable_globally(ENABLED(ENDSTOPS_ALWAYS_ON_DEFAULT));
 
   reset_stepper_drivers();
@@ -3230,9 +3361,19 @@ void MarlinSettings::reset() {
   //
 
   #if ENABLED(LIN_ADVANCE)
+    constexpr float defK[] =
+      #ifdef LIN_ADVANCE_K_LIST
+        LIN_ADVANCE_K_LIST
+      #else
+        { LIN_ADVANCE_K }
+      #endif
+    ;
+    static_assert(WITHIN(COUNT(defK), 1, EXTRUDERS), "LIN_ADVANCE_K_LIST must have between 1 and EXTRUDERS items.");
     EXTRUDER_LOOP() {
-      planner.extruder_advance_K[e] = LIN_ADVANCE_K;
-      TERN_(EXTRA_LIN_ADVANCE_K, other_extruder_advance_K[e] = LIN_ADVANCE_K);
+      const float k = defK[ALIM(e, defK)];
+      planner.extruder_advance_K[e] = k;
+      TERN_(EXTRA_LIN_ADVANCE_K, other_extruder_advance_K[e] = k);
+      TERN_(LIN_ADVANCE_NONLINEAR, planner.extruder_advance_K2[e] = LIN_ADVANCE_K2);
     }
   #endif
 
@@ -3386,6 +3527,11 @@ void MarlinSettings::reset() {
     //
     IF_DISABLED(NO_VOLUMETRICS, gcode.M200_report(forReplay));
 
+    //
+    // M921 Syringe Volume
+    //
+    TERN_(SYRINGE_VOLUME, gcode.M921_report(forReplay));
+
     //
     // M92 Steps per Unit
     //
@@ -3509,6 +3655,7 @@ void MarlinSettings::reset() {
     TERN_(PIDTEMP,        gcode.M301_report(forReplay));
     TERN_(PIDTEMPBED,     gcode.M304_report(forReplay));
     TERN_(PIDTEMPCHAMBER, gcode.M309_report(forReplay));
+    TERN_(PID_CHAMBER_FEEDFORWARD, gcode.M747_report(forReplay));
 
     #if HAS_USER_THERMISTORS
       LOOP_L_N(i, USER_THERMISTORS)
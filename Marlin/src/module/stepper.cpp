@@ -1493,8 +1493,36 @@ HAL_STEP_TIMER_ISR() {
   #define STEP_MULTIPLY(A,B) MultiU24X32toH16(A, B)
 #endif
 
+#if ENABLED(JERK_LIMITED_ACCELERATION)
+
+  /**
+   * Rate change after 't' timer counts into a jerk-limited ramp of 'dv' steps/s.
+   * The ramp raises acceleration at constant jerk, holds it at the peak, then
+   * lowers it again, so the rate follows J/2*t² at both ends and is linear in
+   * between. All fixed-point, with jerk_rate scaled by 2^48.
+   */
+  uint32_t Stepper::_eval_jerk_ramp(const uint32_t t, const uint32_t dv, const uint32_t ramp_time, const uint32_t jerk_time, const uint32_t peak_rate) {
+    auto jerk_dv = [](const uint32_t jt) {
+      return uint32_t(((uint64_t(current_block->jerk_rate) * jt) >> 24) * jt >> 24);
+    };
+    if (t >= ramp_time) return dv;
+    if (t < jerk_time) return _MIN(jerk_dv(t), dv);
+    const uint32_t left = ramp_time - t;
+    if (left < jerk_time) return dv - _MIN(jerk_dv(left), dv);
+    return _MIN(jerk_dv(jerk_time) + STEP_MULTIPLY(t - jerk_time, peak_rate), dv);
+  }
+
+#endif
+
 void Stepper::isr() {
 
+  #if ENABLED(ISR_CYCLE_STATS)
+    // Interrupts are enabled while pulsing, so these times include any ISR
+    // that preempts this one. Serial and USB are the usual ones.
+    const uint32_t isr_start_cycles = ISRStats::start();
+    uint32_t pulse_cycles = 0;      // Cycles spent pulsing, excluded from the base ISR time
+  #endif
+
   static uint32_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
   #ifndef __AVR__
@@ -1520,7 +1548,21 @@ void Stepper::isr() {
     // Enable ISRs to reduce USART processing latency
     hal.isr_on();
 
-    if (!nextMainISR) pulse_phase_isr();                            // 0 = Do coordinated axes Stepper pulses
+    #if ENABLED(ISR_CYCLE_STATS)
+      if (!nextMainISR) {
+        const uint32_t pulse_start_cycles = ISRStats::start(),
+                       events_before = step_events_completed;
+        pulse_phase_isr();                                          // 0 = Do coordinated axes Stepper pulses
+        const uint32_t cycles = ISRStats::start() - pulse_start_cycles,
+                       events = step_events_completed - events_before;
+        if (events) {
+          pulse_cycles += cycles;
+          ISRStats::stat[ISR_STAT_STEP_LOOP].sample(cycles / events);
+        }
+      }
+    #else
+      if (!nextMainISR) pulse_phase_isr();                          // 0 = Do coordinated axes Stepper pulses
+    #endif
 
     #if ENABLED(LIN_ADVANCE)
       if (!nextAdvanceISR) nextAdvanceISR = advance_isr();          // 0 = Do Linear Advance E Stepper pulses
@@ -1533,7 +1575,15 @@ void Stepper::isr() {
 
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-    if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    if (!nextMainISR) {                                 // Manage acc/deceleration, get next block
+      #if ENABLED(ISR_CYCLE_STATS)
+        const uint32_t block_start_cycles = ISRStats::start();
+        nextMainISR = block_phase_isr();
+        ISRStats::sample(ISR_STAT_BLOCK_PHASE, block_start_cycles);
+      #else
+        nextMainISR = block_phase_isr();
+      #endif
+    }
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
@@ -1636,6 +1686,15 @@ void Stepper::isr() {
   // Set the next ISR to fire at the proper time
   HAL_timer_set_compare(MF_TIMER_STEP, hal_timer_t(next_isr_ticks));
 
+  #if ENABLED(ISR_CYCLE_STATS)
+    // Only count calls that stepped, not the Linear Advance or idle ones
+    if (pulse_cycles) {
+      const uint32_t isr_cycles = ISRStats::start() - isr_start_cycles;
+      ISRStats::stat[ISR_STAT_STEPPER].sample(isr_cycles);
+      ISRStats::stat[ISR_STAT_STEPPER_BASE].sample(isr_cycles - pulse_cycles);
+    }
+  #endif
+
   // Don't forget to finally reenable interrupts
   hal.isr_on();
 }
@@ -2012,6 +2071,11 @@ uint32_t Stepper::block_phase_isr() {
           uint32_t acc_step_rate = acceleration_time < current_block->acceleration_time
                                    ? _eval_bezier_curve(acceleration_time)
                                    : current_block->cruise_rate;
+        #elif ENABLED(JERK_LIMITED_ACCELERATION)
+          acc_step_rate = current_block->initial_rate + _eval_jerk_ramp(acceleration_time,
+            current_block->cruise_rate - current_block->initial_rate,
+            current_block->acceleration_time, current_block->accel_jerk_time, current_block->accel_peak_rate
+          );
         #else
           acc_step_rate = STEP_MULTIPLY(acceleration_time, current_block->acceleration_rate) + current_block->initial_rate;
           NOMORE(acc_step_rate, current_block->nominal_rate);
@@ -2079,6 +2143,11 @@ uint32_t Stepper::block_phase_isr() {
               ? _eval_bezier_curve(deceleration_time)
               : current_block->final_rate;
           }
+        #elif ENABLED(JERK_LIMITED_ACCELERATION)
+          step_rate = current_block->cruise_rate - _eval_jerk_ramp(deceleration_time,
+            current_block->cruise_rate - current_block->final_rate,
+            current_block->deceleration_time, current_block->decel_jerk_time, current_block->decel_peak_rate
+          );
         #else
 
           // Using the old trapezoidal control
@@ -2354,6 +2423,7 @@ uint32_t Stepper::block_phase_isr() {
         if (stepper_extruder == 1 && current_block->steps.e > 0) {
           #if PIN_EXISTS(E1_ENABLE)
             WRITE(E1_ENABLE_PIN, HIGH);  // Open valve (PC3 = HIGH = 3.3V)
+            TERN_(SD_LOG, sd_log.valve_changed(true));
             #if ENABLED(DEBUG_PNEUMATIC_EXTRUDER)
               pneumatic_start_ms = millis();
               // Calculate expected duration for debug output
@@ -2888,7 +2958,7 @@ void Stepper::init() {
     E_AXIS_INIT(7);
   #endif
 
-  #if DISABLED(I2S_STEPPER_STREAM)
+  #if NONE(I2S_STEPPER_STREAM, PRINT_TIME_ESTIMATOR)
     HAL_timer_start(MF_TIMER_STEP, 122); // Init Stepper ISR to 122 Hz for quick starting
     wake_up();
     sei();
@@ -2983,6 +3053,21 @@ void Stepper::set_position(const xyze_long_t &spos) {
   if (was_enabled) wake_up();
 }
 
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+
+  // Move the step counts past a block without stepping it
+  void Stepper::skip_block(const block_t * const block) {
+    if (TEST(block->flag, BLOCK_BIT_SYNC_POSITION))
+      _set_position(block->position);
+    else
+      LOOP_LOGICAL_AXES(i) {
+        const int32_t steps = block->steps[i];
+        count_position[i] += TEST(block->direction_bits, i) ? -steps : steps;
+      }
+  }
+
+#endif
+
 void Stepper::set_axis_position(const AxisEnum a, const int32_t &v) {
   planner.synchronize();
 
@@ -48,6 +48,12 @@
 #ifdef __AVR__
   #include "speed_lookuptable.h"
 #endif
+#if ENABLED(ISR_CYCLE_STATS)
+  #include "../feature/isr_stats.h"
+#endif
+#if ENABLED(SD_LOG)
+  #include "../feature/sd_log.h"
+#endif
 
 // Disable multiple steps per ISR
 //#define DISABLE_MULTI_STEPPING
@@ -86,7 +92,7 @@
   #endif
 
   // S curve interpolation adds 40 cycles
-  #if ENABLED(S_CURVE_ACCELERATION)
+  #if EITHER(S_CURVE_ACCELERATION, JERK_LIMITED_ACCELERATION)
     #define ISR_S_CURVE_CYCLES 40UL
   #else
     #define ISR_S_CURVE_CYCLES 0UL
@@ -116,7 +122,7 @@
   #endif
 
   // S curve interpolation adds 160 cycles
-  #if ENABLED(S_CURVE_ACCELERATION)
+  #if EITHER(S_CURVE_ACCELERATION, JERK_LIMITED_ACCELERATION)
     #define ISR_S_CURVE_CYCLES 160UL
   #else
     #define ISR_S_CURVE_CYCLES 0UL
@@ -243,7 +249,11 @@
 // The minimum step ISR rate used by ADAPTIVE_STEP_SMOOTHING to target 50% CPU usage
 // This does not account for the possibility of multi-stepping.
 // Perhaps DISABLE_MULTI_STEPPING should be required with ADAPTIVE_STEP_SMOOTHING.
-#define MIN_STEP_ISR_FREQUENCY (MAX_STEP_ISR_FREQUENCY_1X / 2)
+#if ENABLED(ISR_CYCLE_STATS)
+  #define MIN_STEP_ISR_FREQUENCY (ISRStats::step_limit[0] / 2)
+#else
+  #define MIN_STEP_ISR_FREQUENCY (MAX_STEP_ISR_FREQUENCY_1X / 2)
+#endif
 
 #define ENABLE_COUNT (NUM_AXES + E_STEPPERS)
 typedef IF<(ENABLE_COUNT > 8), uint16_t, uint8_t>::type ena_mask_t;
@@ -523,6 +533,11 @@ class Stepper {
     static void report_a_position(const xyz_long_t &pos);
     static void report_positions();
 
+    #if ENABLED(PRINT_TIME_ESTIMATOR)
+      // Apply a block to the stepper position without stepping
+      static void skip_block(const block_t * const block);
+    #endif
+
     // Discard current block and free any resources
     FORCE_INLINE static void discard_current_block() {
       #if ENABLED(PNEUMATIC_EXTRUDER_E1)
@@ -530,6 +545,7 @@ class Stepper {
         if (current_block && stepper_extruder == 1) {
           #if PIN_EXISTS(E1_ENABLE)
             WRITE(E1_ENABLE_PIN, LOW);  // Close valve (PC3 = LOW = 0V)
+            TERN_(SD_LOG, sd_log.valve_changed(false));
             #if ENABLED(DEBUG_PNEUMATIC_EXTRUDER)
               const uint32_t actual_duration_ms = millis() - pneumatic_start_ms;
               SERIAL_ECHOPGM("Pneumatic E1: Valve CLOSED - Actual duration: ");
@@ -675,27 +691,34 @@ class Stepper {
       uint8_t multistep = 1;
       #if DISABLED(DISABLE_MULTI_STEPPING)
 
-        // The stepping frequency limits for each multistepping rate
-        static const uint32_t limit[] PROGMEM = {
-          (  MAX_STEP_ISR_FREQUENCY_1X     ),
-          (  MAX_STEP_ISR_FREQUENCY_2X >> 1),
-          (  MAX_STEP_ISR_FREQUENCY_4X >> 2),
-          (  MAX_STEP_ISR_FREQUENCY_8X >> 3),
-          ( MAX_STEP_ISR_FREQUENCY_16X >> 4),
-          ( MAX_STEP_ISR_FREQUENCY_32X >> 5),
-          ( MAX_STEP_ISR_FREQUENCY_64X >> 6),
-          (MAX_STEP_ISR_FREQUENCY_128X >> 7)
-        };
+        #if ENABLED(ISR_CYCLE_STATS)
+          // The stepping frequency limits, derived from measured ISR cycles
+          #define _STEP_LIMIT(N) ISRStats::step_limit[N]
+        #else
+          // The stepping frequency limits for each multistepping rate
+          static const uint32_t limit[] PROGMEM = {
+            (  MAX_STEP_ISR_FREQUENCY_1X     ),
+            (  MAX_STEP_ISR_FREQUENCY_2X >> 1),
+            (  MAX_STEP_ISR_FREQUENCY_4X >> 2),
+            (  MAX_STEP_ISR_FREQUENCY_8X >> 3),
+            ( MAX_STEP_ISR_FREQUENCY_16X >> 4),
+            ( MAX_STEP_ISR_FREQUENCY_32X >> 5),
+            ( MAX_STEP_ISR_FREQUENCY_64X >> 6),
+            (MAX_STEP_ISR_FREQUENCY_128X >> 7)
+          };
+          #define _STEP_LIMIT(N) (uint32_t)pgm_read_dword(&limit[N])
+        #endif
 
         // Select the proper multistepping
         uint8_t idx = 0;
-        while (idx < 7 && step_rate > (uint32_t)pgm_read_dword(&limit[idx])) {
+        while (idx < 7 && step_rate > _STEP_LIMIT(idx)) {
           step_rate >>= 1;
           multistep <<= 1;
           ++idx;
         };
+        #undef _STEP_LIMIT
       #else
-        NOMORE(step_rate, uint32_t(MAX_STEP_ISR_FREQUENCY_1X));
+        NOMORE(step_rate, uint32_t(TERN(ISR_CYCLE_STATS, ISRStats::step_limit[0], MAX_STEP_ISR_FREQUENCY_1X)));
       #endif
       *loops = multistep;
 
@@ -729,6 +752,8 @@ class Stepper {
     #if ENABLED(S_CURVE_ACCELERATION)
       static void _calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av);
       static int32_t _eval_bezier_curve(const uint32_t curr_step);
+    #elif ENABLED(JERK_LIMITED_ACCELERATION)
+      static uint32_t _eval_jerk_ramp(const uint32_t t, const uint32_t dv, const uint32_t ramp_time, const uint32_t jerk_time, const uint32_t peak_rate);
     #endif
 
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
@@ -36,6 +36,14 @@
 #include "planner.h"
 #include "printcounter.h"
 
+#if ENABLED(THERMISTOR_FINE_TABLES)
+  #include "thermistor/fine_table.h"
+#endif
+
+#if ENABLED(ADC_CONTINUOUS_SCAN)
+  #include "../HAL/shared/adc_scan.h"
+#endif
+
 #if EITHER(HAS_COOLER, LASER_COOLANT_FLOW_METER)
   #include "../feature/cooler.h"
   #include "../feature/spindle_laser.h"
@@ -174,6 +182,18 @@
   #include "../feature/joystick.h"
 #endif
 
+#if ENABLED(ISR_CYCLE_STATS)
+  #include "../feature/isr_stats.h"
+#endif
+
+#if ENABLED(TEMP_HISTORY)
+  #include "../feature/temp_history.h"
+#endif
+
+#if ENABLED(MULTI_ZONE_WAIT)
+  #include "../feature/zone_wait.h"
+#endif
+
 #if ENABLED(SINGLENOZZLE)
   #include "tool_change.h"
 #endif
@@ -859,6 +879,417 @@ volatile bool Temperature::raw_temps_ready = false;
       return;
   }
 
+  #if ENABLED(PID_STEP_AUTOTUNE)
+
+    #define STEP_TUNE_SPAN   6    // (s) Span of each slope taken for the fit
+    #define STEP_TUNE_RISE   1.0f // (°C) Change that marks the end of the dead time
+    #define STEP_TUNE_MARKS  12   // Points kept for the dead time, every 0.5°C
+
+    // Working state of one zone
+    typedef struct {
+      heater_id_t id;
+      celsius_t target;
+      int8_t dir;                           // 1 to heat, -1 to cool a Peltier zone
+      enum : uint8_t { BASELINE, STEP, RELAY, DONE, FAILED } state;
+      uint8_t max_power, u;                 // Power limit and step power
+      float acc; uint8_t acc_n;             // Readings within this second
+      float y0;                             // Temperature before the step
+      uint16_t secs;                        // Seconds in this state
+      float hist[STEP_TUNE_SPAN + 1];       // Change since the step, one per second
+      // Fit of the slope against the change: slope = a - b * change
+      uint16_t n; float mx, my, cxx, cxy, cyy;
+      uint8_t marks; float mark_t[STEP_TUNE_MARKS], mark_r[STEP_TUNE_MARKS];
+      // Relay feedback
+      bool on; millis_t switch_ms, on_ms; float hi, lo, Tu[2], amp[2]; uint8_t cycles;
+      #if WATCH_PID
+        float next_watch; millis_t watch_ms; // Change due by the watch time, as in PID_autotune
+      #endif
+      PID_t pid;
+    } step_tune_t;
+
+    // Can the zone be driven in this direction? A Peltier zone only
+    // heats or cools as its mode pin (M42 P60) allows.
+    static bool step_tune_drive_ok(const heater_id_t id, const int8_t dir) {
+      #if ENABLED(PELTIER_CONTROL_E0) && HAS_TEMP_CHAMBER
+        if (id == H_E0) {
+          #if CUSTOM_BED_PIN
+            return READ(CUSTOM_BED_PIN) == (dir > 0); // HIGH=heat, LOW=cool
+          #else
+            return true;
+          #endif
+        }
+      #endif
+      return dir > 0;
+    }
+
+    /**
+     * PID Autotuning from the step response (M303 Q)
+     *
+     * Each zone holds still for a few seconds, then gets a step of power. The
+     * slope of the response is fitted against its size as it goes, which gives
+     * the gain and time constant of a first-order plus dead time model, and the
+     * zone is done when the time constant is known well enough. The gains then
+     * come from the IMC rules, with a slower closed loop for the bed and chamber.
+     * A zone that reaches its target first goes on with relay feedback around
+     * the target and is done when two cycles agree.
+     */
+    void Temperature::PID_step_autotune(const step_tune_zone_t zones[], const uint8_t count, const bool set_result/*=false*/) {
+      step_tune_t tune[PID_STEP_ZONES];
+      const uint8_t nz = _MIN(count, PID_STEP_ZONES);
+
+      auto temp_of = [](const heater_id_t id) -> celsius_float_t {
+        switch (id) {
+          #if ENABLED(PIDTEMPBED)
+            case H_BED: return degBed();
+          #endif
+          #if ENABLED(PIDTEMPCHAMBER)
+            case H_CHAMBER: return degChamber();
+          #endif
+          default: return TERN0(PIDTEMP, degHotend(id));
+        }
+      };
+
+      auto set_power = [](const heater_id_t id, const uint8_t v) {
+        switch (id) {
+          #if ENABLED(PIDTEMPBED)
+            case H_BED: temp_bed.soft_pwm_amount = v >> 1; break;
+          #endif
+          #if ENABLED(PIDTEMPCHAMBER)
+            case H_CHAMBER: temp_chamber.soft_pwm_amount = v >> 1; break;
+          #endif
+          default: TERN_(PIDTEMP, temp_hotend[id].soft_pwm_amount = v >> 1); break;
+        }
+      };
+
+      auto say_zone = [](const heater_id_t id) {
+        switch (id) {
+          case H_BED: SERIAL_ECHOPGM("Bed"); break;
+          case H_CHAMBER: SERIAL_ECHOPGM("Chamber"); break;
+          default: SERIAL_CHAR('E', '0' + id); break;
+        }
+        SERIAL_ECHOPGM(": ");
+      };
+
+      auto stop_zone = [&](step_tune_t &z, const bool ok) {
+        set_power(z.id, 0);
+        z.state = ok ? step_tune_t::DONE : step_tune_t::FAILED;
+      };
+
+      // Check all the zones before anything is turned on
+      disable_all_heaters();
+      LOOP_L_N(i, nz) {
+        step_tune_t &z = tune[i];
+        z = {};
+        z.id = zones[i].id;
+        z.target = zones[i].target;
+        const bool isbed = z.id == H_BED, ischamber = z.id == H_CHAMBER;
+        const celsius_t maxtarget = ischamber ? TERN(PIDTEMPCHAMBER, CHAMBER_MAX_TARGET, 0)
+                                  : isbed ? TERN(PIDTEMPBED, BED_MAX_TARGET, 0)
+                                  : TERN(PIDTEMP, temp_range[z.id].maxtemp - (HOTEND_OVERSHOOT), 0);
+        z.max_power = ischamber ? TERN(PIDTEMPCHAMBER, MAX_CHAMBER_POWER, 0)
+                    : isbed ? TERN(PIDTEMPBED, MAX_BED_POWER, 0)
+                    : PID_MAX;
+        z.u = uint8_t(z.max_power * (PID_STEP_AUTOTUNE_POWER) / 100);
+        z.dir = z.target < temp_of(z.id) ? -1 : 1;
+        if (z.target > maxtarget) {
+          say_zone(z.id); SERIAL_ECHOPGM(STR_PID_AUTOTUNE); SERIAL_ECHOLNPGM(STR_PID_TEMP_TOO_HIGH);
+          return;
+        }
+        #if ENABLED(PIDTEMP)
+          if (z.id >= 0 && z.target < temp_range[z.id].mintemp) {
+            say_zone(z.id); SERIAL_ECHOLNPGM("Target below MINTEMP");
+            return;
+          }
+        #endif
+        if (!step_tune_drive_ok(z.id, z.dir)) {
+          say_zone(z.id);
+          SERIAL_ECHOF(z.dir > 0 ? F("Heating") : F("Cooling"));
+          SERIAL_ECHOLNPGM(" to the target is not allowed");
+          return;
+        }
+      }
+
+      TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_STARTED));
+      SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+      SERIAL_ECHOLNPGM(STR_PID_AUTOTUNE_START);
+      TERN_(AUTO_POWER_CONTROL, powerManager.power_on());
+      TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = false);
+      LCD_MESSAGE(MSG_HEATING);
+
+      const millis_t start_ms = millis();
+      millis_t next_sec_ms = start_ms + 1000UL, next_temp_ms = start_ms;
+      bool failed = false;
+
+      wait_for_heatup = true;
+      while (wait_for_heatup) { // Can be interrupted with M108
+        const millis_t ms = millis();
+
+        if (updateTemperaturesIfReady()) {
+          TERN_(HAS_FAN_LOGIC, manage_extruder_fans(ms));
+          LOOP_L_N(i, nz) {
+            step_tune_t &z = tune[i];
+            if (z.state >= step_tune_t::DONE) continue;
+            const celsius_float_t t = temp_of(z.id);
+            z.acc += t; z.acc_n++;
+
+            // Did the temperature overshoot very far?
+            #ifndef MAX_OVERSHOOT_PID_AUTOTUNE
+              #define MAX_OVERSHOOT_PID_AUTOTUNE 30
+            #endif
+            if (z.dir * (t - z.target) > MAX_OVERSHOOT_PID_AUTOTUNE) {
+              say_zone(z.id); SERIAL_ECHOPGM(STR_PID_AUTOTUNE); SERIAL_ECHOLNPGM(STR_PID_TEMP_TOO_HIGH);
+              TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_TEMP_TOO_HIGH));
+              failed = true;
+            }
+
+            // Relay feedback switches at the target, holding each side 5s or more
+            if (z.state == step_tune_t::RELAY) {
+              const float r = z.dir * t;
+              NOLESS(z.hi, r); NOMORE(z.lo, r);
+              const bool below = r < z.dir * z.target;
+              if (below != z.on && ELAPSED(ms, z.switch_ms + 5000UL)) {
+                z.on = below;
+                z.switch_ms = ms;
+                set_power(z.id, z.on ? z.u : 0);
+                if (z.on) {
+                  if (z.on_ms) {
+                    z.Tu[1] = z.Tu[0]; z.amp[1] = z.amp[0];
+                    z.Tu[0] = (ms - z.on_ms) * 0.001f;
+                    z.amp[0] = (z.hi - z.lo) * 0.5f;
+                    if (z.cycles < 255) z.cycles++;
+                  }
+                  z.on_ms = ms;
+                  z.hi = z.lo = r;
+                }
+              }
+            }
+          }
+        }
+
+        if (failed) break;
+
+        // Work on the average of each second
+        if (ELAPSED(ms, next_sec_ms)) {
+          next_sec_ms += 1000UL;
+          constexpr float conf = (PID_STEP_AUTOTUNE_CONFIDENCE) * 0.01f;
+          uint8_t busy = 0;
+
+          LOOP_L_N(i, nz) {
+            step_tune_t &z = tune[i];
+            if (z.state >= step_tune_t::DONE) continue;
+            busy++;
+            if (!z.acc_n) continue;
+            const float y = z.acc / z.acc_n;
+            z.acc = 0; z.acc_n = 0;
+            z.secs++;
+
+            if (!step_tune_drive_ok(z.id, z.dir)) {
+              say_zone(z.id); SERIAL_ECHOLNPGM("Peltier mode changed. Stopped.");
+              stop_zone(z, false);
+              continue;
+            }
+
+            const bool isbed = z.id == H_BED, ischamber = z.id == H_CHAMBER;
+
+            // Make sure the drive is actually working, the same as PID_autotune
+            #if WATCH_PID
+              if (BOTH(WATCH_BED, WATCH_HOTENDS) || isbed == DISABLED(WATCH_HOTENDS) || ischamber == DISABLED(WATCH_HOTENDS)) {
+                if (z.state == step_tune_t::STEP) {
+                  const float r = z.dir * (y - z.y0);
+                  if (r > z.next_watch) {
+                    z.next_watch = r + GTV(WATCH_CHAMBER_TEMP_INCREASE, WATCH_BED_TEMP_INCREASE, WATCH_TEMP_INCREASE);
+                    z.watch_ms = ms + SEC_TO_MS(GTV(WATCH_CHAMBER_TEMP_PERIOD, WATCH_BED_TEMP_PERIOD, WATCH_TEMP_PERIOD));
+                  }
+                  else if (ELAPSED(ms, z.watch_ms))
+                    _temp_error(z.id, FPSTR(str_t_heating_failed), GET_TEXT_F(MSG_HEATING_FAILED_LCD));
+                }
+                else if (z.state == step_tune_t::RELAY && z.dir * (z.target - y) > MAX_OVERSHOOT_PID_AUTOTUNE)
+                  _temp_error(z.id, FPSTR(str_t_thermal_runaway), GET_TEXT_F(MSG_THERMAL_RUNAWAY));
+              }
+            #endif
+
+            switch (z.state) {
+              case step_tune_t::BASELINE:
+                // Average a few seconds with no power, then apply the step
+                z.y0 += y;
+                if (z.secs == STEP_TUNE_SPAN) {
+                  z.y0 /= STEP_TUNE_SPAN;
+                  z.secs = 0;
+                  z.state = step_tune_t::STEP;
+                  set_power(z.id, z.u);
+                  #if WATCH_PID
+                    z.next_watch = GTV(WATCH_CHAMBER_TEMP_INCREASE, WATCH_BED_TEMP_INCREASE, WATCH_TEMP_INCREASE);
+                    z.watch_ms = ms + SEC_TO_MS(GTV(WATCH_CHAMBER_TEMP_PERIOD, WATCH_BED_TEMP_PERIOD, WATCH_TEMP_PERIOD));
+                  #endif
+                }
+                break;
+
+              case step_tune_t::STEP: {
+                const float r = z.dir * (y - z.y0);
+                for (uint8_t k = STEP_TUNE_SPAN; k; --k) z.hist[k] = z.hist[k - 1];
+                z.hist[0] = r;
+
+                // Times of the first 0.5°C steps of the change, for the dead time
+                if (z.marks < STEP_TUNE_MARKS && r >= 0.5f * (z.marks + 1)) {
+                  z.mark_t[z.marks] = z.secs - 0.5f;
+                  z.mark_r[z.marks] = r;
+                  z.marks++;
+                }
+
+                // Add the slope against the change once past the dead time
+                if (z.secs > STEP_TUNE_SPAN && z.hist[STEP_TUNE_SPAN] >= STEP_TUNE_RISE) {
+                  const float sx = (z.hist[0] + z.hist[STEP_TUNE_SPAN]) * 0.5f,
+                              sy = (z.hist[0] - z.hist[STEP_TUNE_SPAN]) / STEP_TUNE_SPAN,
+                              dx = sx - z.mx, dy = sy - z.my;
+                  z.n++;
+                  z.mx += dx / z.n;
+                  z.my += dy / z.n;
+                  z.cxx += dx * (sx - z.mx);
+                  z.cxy += dx * (sy - z.my);
+                  z.cyy += dy * (sy - z.my);
+                }
+
+                if (z.n >= 20 && z.cxx > 0) {
+                  const float b = -z.cxy / z.cxx, a = z.my + b * z.mx;
+                  const float s2 = _MAX(0.0f, z.cyy - b * b * z.cxx) / (z.n - 2);
+                  if (b > 0 && a > 0 && SQRT(s2 / z.cxx) < conf * b) {
+                    // Model: gain in °C per unit of power, time constant and dead time
+                    const float rmax = a / b, K = rmax / z.u, tau = 1.0f / b;
+                    float theta = 0;
+                    uint8_t tn = 0;
+                    LOOP_L_N(k, z.marks) if (z.mark_r[k] < 0.9f * rmax) {
+                      theta += z.mark_t[k] + tau * logf(1.0f - z.mark_r[k] / rmax);
+                      tn++;
+                    }
+                    theta = tn ? _MAX(0.0f, theta / tn) : 0.0f;
+
+                    const float lambda = _MAX(theta, tau * ((isbed || ischamber) ? 0.5f : 0.25f)),
+                                Ti = tau + theta * 0.5f,
+                                Kc = Ti / (K * (lambda + theta * 0.5f)),
+                                Td = tau * theta / (2.0f * tau + theta);
+                    z.pid.Kp = Kc;
+                    z.pid.Ki = Kc / Ti;
+                    z.pid.Kd = Kc * Td;
+                    say_zone(z.id); SERIAL_ECHOLNPGM("K ", K, " Tau ", tau, " Theta ", theta, " (", z.secs, "s)");
+                    stop_zone(z, true);
+                    break;
+                  }
+                }
+
+                // At the target with no good fit yet, so go on with relay feedback
+                if (z.dir * (y - z.target) >= 0) {
+                  say_zone(z.id); SERIAL_ECHOLNPGM("Reached the target. Relay feedback.");
+                  z.state = step_tune_t::RELAY;
+                  z.secs = 0;
+                  z.on = true;
+                  z.switch_ms = ms;
+                  z.on_ms = 0;
+                }
+              } break;
+
+              case step_tune_t::RELAY:
+                // Done when the last two cycles agree
+                if (z.cycles >= 2 && z.amp[0] > 0
+                  && ABS(z.Tu[0] - z.Tu[1]) < conf * z.Tu[0]
+                  && ABS(z.amp[0] - z.amp[1]) < conf * z.amp[0]
+                ) {
+                  const float Ku = (4.0f * z.u * 0.5f) / (float(M_PI) * z.amp[0]),
+                              Tu = z.Tu[0],
+                              pf = (ischamber || isbed) ? 0.2f : 0.6f,
+                              df = (ischamber || isbed) ? 1.0f / 3.0f : 1.0f / 8.0f;
+                  z.pid.Kp = Ku * pf;
+                  z.pid.Ki = z.pid.Kp * 2.0f / Tu;
+                  z.pid.Kd = z.pid.Kp * Tu * df;
+                  say_zone(z.id); SERIAL_ECHOLNPGM(STR_KU, Ku, STR_TU, Tu);
+                  stop_zone(z, true);
+                }
+                break;
+
+              default: break;
+            }
+
+            if (z.state >= step_tune_t::DONE) busy--;
+          }
+
+          if (!busy) break;
+        }
+
+        // Give up on zones not done in time
+        if (ELAPSED(ms, start_ms + MIN_TO_MS(PID_STEP_AUTOTUNE_TIMEOUT))) {
+          TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_TUNING_TIMEOUT));
+          SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+          SERIAL_ECHOLNPGM(STR_PID_TIMEOUT);
+          LOOP_L_N(i, nz) if (tune[i].state < step_tune_t::DONE) stop_zone(tune[i], false);
+          break;
+        }
+
+        // Report heater states every 2 seconds
+        if (ELAPSED(ms, next_temp_ms)) {
+          #if HAS_TEMP_SENSOR
+            print_heater_states(active_extruder);
+            SERIAL_EOL();
+          #endif
+          next_temp_ms = ms + 2000UL;
+        }
+
+        hal.idletask();
+        TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+      }
+      const bool aborted = wait_for_heatup == false;
+      wait_for_heatup = false;
+
+      disable_all_heaters();
+
+      if (!failed && !aborted) {
+        SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+        SERIAL_ECHOLNPGM(STR_PID_AUTOTUNE_FINISHED);
+        LOOP_L_N(i, nz) {
+          const step_tune_t &z = tune[i];
+          if (z.state != step_tune_t::DONE) continue;
+          const PID_t &p = z.pid;
+          switch (z.id) {
+            #if ENABLED(PIDTEMPBED)
+              case H_BED:
+                SERIAL_ECHOLNPGM("M304 P", p.Kp, " I", p.Ki, " D", p.Kd);
+                if (set_result) {
+                  temp_bed.pid.Kp = p.Kp;
+                  temp_bed.pid.Ki = scalePID_i(p.Ki);
+                  temp_bed.pid.Kd = scalePID_d(p.Kd);
+                }
+                break;
+            #endif
+            #if ENABLED(PIDTEMPCHAMBER)
+              case H_CHAMBER:
+                SERIAL_ECHOLNPGM("M309 P", p.Kp, " I", p.Ki, " D", p.Kd);
+                if (set_result) {
+                  temp_chamber.pid.Kp = p.Kp;
+                  temp_chamber.pid.Ki = scalePID_i(p.Ki);
+                  temp_chamber.pid.Kd = scalePID_d(p.Kd);
+                }
+                break;
+            #endif
+            default:
+              #if ENABLED(PIDTEMP)
+                SERIAL_ECHOLNPGM("M301 E", z.id, " P", p.Kp, " I", p.Ki, " D", p.Kd);
+                if (set_result) {
+                  PID_PARAM(Kp, z.id) = p.Kp;
+                  PID_PARAM(Ki, z.id) = scalePID_i(p.Ki);
+                  PID_PARAM(Kd, z.id) = scalePID_d(p.Kd);
+                  updatePID();
+                }
+              #endif
+              break;
+          }
+        }
+        TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_PID_AUTOTUNE_DONE)));
+      }
+
+      TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_DONE));
+      TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = true);
+    }
+
+  #endif // PID_STEP_AUTOTUNE
+
 #endif // HAS_PID_HEATING
 
 #if ENABLED(MPCTEMP)
@@ -1321,6 +1752,30 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
   bool Temperature::pid_debug_flag; // = 0
 #endif
 
+#if ENABLED(PID_CHAMBER_FEEDFORWARD)
+
+  /**
+   * Once the zone has held its target for CHAMBER_FF_SETTLE_TIME, its output is
+   * the power that balances the loss to the chamber. Move Ka toward it slowly.
+   * The integral term gives up the share that the feed-forward takes over.
+   */
+  void ChamberFF::learn(const float delta, const float error, const float power) {
+    if (ABS(error) > (CHAMBER_FF_SETTLE_BAND) || ABS(delta) < (CHAMBER_FF_MIN_DELTA)) {
+      settling = false;
+      return;
+    }
+    const millis_t ms = millis();
+    if (!settling) {
+      settling = true;
+      settle_ms = ms + SEC_TO_MS(CHAMBER_FF_SETTLE_TIME);
+    }
+    if (PENDING(ms, settle_ms)) return;
+    float &k = Ka[delta < 0];
+    k += (power / ABS(delta) - k) * (1.0f / (1UL << (CHAMBER_FF_LEARN_SHIFT)));
+  }
+
+#endif
+
 #if HAS_HOTEND
 
   float Temperature::get_pid_output_hotend(const uint8_t E_NAME) {
@@ -1332,6 +1787,19 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
                      temp_dState[HOTENDS] = { 0 };
         static Flags<HOTENDS> pid_reset;
 
+        #if ENABLED(PID_CONTROL_LOOPS)
+          const celsius_float_t current = temp_hotend[ee].loop.input();
+          const uint8_t rounds = temp_hotend[ee].loop.rounds;
+        #else
+          const celsius_float_t current = temp_hotend[ee].celsius;
+          constexpr uint8_t rounds = 1;
+        #endif
+
+        #if ENABLED(PID_CHAMBER_FEEDFORWARD)
+          // Target above (+) or below (-) the chamber, for the feed-forward
+          float ff_delta = temp_hotend[ee].target - temp_chamber.celsius;
+        #endif
+
         // BIOPRINTER: Bidirectional PID for Peltier heating/cooling
         // Compare target against chamber temp to determine heating vs cooling mode
         #if ENABLED(PELTIER_CONTROL_E0) && HAS_TEMP_CHAMBER
@@ -1347,30 +1815,33 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
               // Wants to HEAT
               if (mode_pin_state) {
                 // Pin is HIGH - heating allowed
-                pid_error = temp_hotend[ee].target - temp_hotend[ee].celsius;
+                pid_error = temp_hotend[ee].target - current;
               } else {
                 // Pin is LOW - heating blocked, return 0
                 pid_error = 0;
+                TERN_(PID_CHAMBER_FEEDFORWARD, ff_delta = 0);
               }
             } else {
               // Wants to COOL
               if (!mode_pin_state) {
                 // Pin is LOW - cooling allowed
-                pid_error = temp_hotend[ee].celsius - temp_hotend[ee].target;  // Inverted
+                pid_error = current - temp_hotend[ee].target;  // Inverted
               } else {
                 // Pin is HIGH - cooling blocked, return 0
                 pid_error = 0;
+                TERN_(PID_CHAMBER_FEEDFORWARD, ff_delta = 0);
               }
             }
           #else
             // No mode pin - automatic mode
             if (temp_hotend[ee].target > chamber_current)
-              pid_error = temp_hotend[ee].target - temp_hotend[ee].celsius;  // Heating mode
+              pid_error = temp_hotend[ee].target - current;  // Heating mode
             else
-              pid_error = temp_hotend[ee].celsius - temp_hotend[ee].target;  // Cooling mode (inverted)
+              pid_error = current - temp_hotend[ee].target;  // Cooling mode (inverted)
           #endif
         #else
-          const float pid_error = temp_hotend[ee].target - temp_hotend[ee].celsius;
+          const float pid_error = temp_hotend[ee].target - current;
+          TERN_(PID_CHAMBER_FEEDFORWARD, NOLESS(ff_delta, 0)); // A heater can't cool
         #endif
 
         float pid_output;
@@ -1381,10 +1852,12 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
         ) {
           pid_output = 0;
           pid_reset.set(ee);
+          TERN_(PID_CHAMBER_FEEDFORWARD, temp_hotend[ee].ff.settling = false);
         }
         else if (pid_error > PID_FUNCTIONAL_RANGE) {
           pid_output = PID_MAX;
           pid_reset.set(ee);
+          TERN_(PID_CHAMBER_FEEDFORWARD, temp_hotend[ee].ff.settling = false);
         }
         else {
           if (pid_reset[ee]) {
@@ -1393,13 +1866,14 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
             pid_reset.clear(ee);
           }
 
-          work_pid[ee].Kd = work_pid[ee].Kd + PID_K2 * (PID_PARAM(Kd, ee) * (temp_dState[ee] - temp_hotend[ee].celsius) - work_pid[ee].Kd);
+          work_pid[ee].Kd = work_pid[ee].Kd + PID_K2 * (PID_PARAM(Kd, ee) * (temp_dState[ee] - current) / rounds - work_pid[ee].Kd);
           const float max_power_over_i_gain = float(PID_MAX) / PID_PARAM(Ki, ee) - float(MIN_POWER);
-          temp_iState[ee] = constrain(temp_iState[ee] + pid_error, 0, max_power_over_i_gain);
+          temp_iState[ee] = constrain(temp_iState[ee] + pid_error * rounds, 0, max_power_over_i_gain);
           work_pid[ee].Kp = PID_PARAM(Kp, ee) * pid_error;
           work_pid[ee].Ki = PID_PARAM(Ki, ee) * temp_iState[ee];
 
           pid_output = work_pid[ee].Kp + work_pid[ee].Ki + work_pid[ee].Kd + float(MIN_POWER);
+          TERN_(PID_CHAMBER_FEEDFORWARD, pid_output += temp_hotend[ee].ff.output(ff_delta));
 
           #if ENABLED(PID_EXTRUSION_SCALING)
             #if HOTENDS == 1
@@ -1431,8 +1905,9 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
             //pid_output += work_pid[ee].Ki * work_pid[ee].Kf
           #endif // PID_FAN_SCALING
           LIMIT(pid_output, 0, PID_MAX);
+          TERN_(PID_CHAMBER_FEEDFORWARD, temp_hotend[ee].ff.learn(ff_delta, pid_error, pid_output));
         }
-        temp_dState[ee] = temp_hotend[ee].celsius;
+        temp_dState[ee] = current;
 
       #else // PID_OPENLOOP
 
@@ -1555,17 +2030,29 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
       static PID_t work_pid{0};
       static float temp_iState = 0, temp_dState = 0;
       static bool pid_reset = true;
+      #if ENABLED(PID_CONTROL_LOOPS)
+        const celsius_float_t current = temp_bed.loop.input();
+        const uint8_t rounds = temp_bed.loop.rounds;
+      #else
+        const celsius_float_t current = temp_bed.celsius;
+        constexpr uint8_t rounds = 1;
+      #endif
       float pid_output = 0;
       const float max_power_over_i_gain = float(MAX_BED_POWER) / temp_bed.pid.Ki - float(MIN_BED_POWER),
-                  pid_error = temp_bed.target - temp_bed.celsius;
+                  pid_error = temp_bed.target - current;
+      #if ENABLED(PID_CHAMBER_FEEDFORWARD)
+        const float ff_delta = _MAX(temp_bed.target - temp_chamber.celsius, 0);
+      #endif
 
       if (!temp_bed.target || pid_error < -(PID_FUNCTIONAL_RANGE)) {
         pid_output = 0;
         pid_reset = true;
+        TERN_(PID_CHAMBER_FEEDFORWARD, temp_bed.ff.settling = false);
       }
       else if (pid_error > PID_FUNCTIONAL_RANGE) {
         pid_output = MAX_BED_POWER;
         pid_reset = true;
+        TERN_(PID_CHAMBER_FEEDFORWARD, temp_bed.ff.settling = false);
       }
       else {
         if (pid_reset) {
@@ -1574,15 +2061,18 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
           pid_reset = false;
         }
 
-        temp_iState = constrain(temp_iState + pid_error, 0, max_power_over_i_gain);
+        temp_iState = constrain(temp_iState + pid_error * rounds, 0, max_power_over_i_gain);
 
         work_pid.Kp = temp_bed.pid.Kp * pid_error;
         work_pid.Ki = temp_bed.pid.Ki * temp_iState;
-        work_pid.Kd = work_pid.Kd + PID_K2 * (temp_bed.pid.Kd * (temp_dState - temp_bed.celsius) - work_pid.Kd);
+        work_pid.Kd = work_pid.Kd + PID_K2 * (temp_bed.pid.Kd * (temp_dState - current) / rounds - work_pid.Kd);
 
-        temp_dState = temp_bed.celsius;
+        temp_dState = current;
 
-        pid_output = constrain(work_pid.Kp + work_pid.Ki + work_pid.Kd + float(MIN_BED_POWER), 0, MAX_BED_POWER);
+        pid_output = work_pid.Kp + work_pid.Ki + work_pid.Kd + float(MIN_BED_POWER);
+        TERN_(PID_CHAMBER_FEEDFORWARD, pid_output += temp_bed.ff.output(ff_delta));
+        LIMIT(pid_output, 0, MAX_BED_POWER);
+        TERN_(PID_CHAMBER_FEEDFORWARD, temp_bed.ff.learn(ff_delta, pid_error, pid_output));
       }
 
     #else // PID_OPENLOOP
@@ -1618,9 +2108,16 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
       static PID_t work_pid{0};
       static float temp_iState = 0, temp_dState = 0;
       static bool pid_reset = true;
+      #if ENABLED(PID_CONTROL_LOOPS)
+        const celsius_float_t current = temp_chamber.loop.input();
+        const uint8_t rounds = temp_chamber.loop.rounds;
+      #else
+        const celsius_float_t current = temp_chamber.celsius;
+        constexpr uint8_t rounds = 1;
+      #endif
       float pid_output = 0;
       const float max_power_over_i_gain = float(MAX_CHAMBER_POWER) / temp_chamber.pid.Ki - float(MIN_CHAMBER_POWER),
-                  pid_error = temp_chamber.target - temp_chamber.celsius;
+                  pid_error = temp_chamber.target - current;
 
       if (!temp_chamber.target || pid_error < -(PID_FUNCTIONAL_RANGE)) {
         pid_output = 0;
@@ -1637,13 +2134,13 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
           pid_reset = false;
         }
 
-        temp_iState = constrain(temp_iState + pid_error, 0, max_power_over_i_gain);
+        temp_iState = constrain(temp_iState + pid_error * rounds, 0, max_power_over_i_gain);
 
         work_pid.Kp = temp_chamber.pid.Kp * pid_error;
         work_pid.Ki = temp_chamber.pid.Ki * temp_iState;
-        work_pid.Kd = work_pid.Kd + PID_K2 * (temp_chamber.pid.Kd * (temp_dState - temp_chamber.celsius) - work_pid.Kd);
+        work_pid.Kd = work_pid.Kd + PID_K2 * (temp_chamber.pid.Kd * (temp_dState - current) / rounds - work_pid.Kd);
 
-        temp_dState = temp_chamber.celsius;
+        temp_dState = current;
 
         pid_output = constrain(work_pid.Kp + work_pid.Ki + work_pid.Kd + float(MIN_CHAMBER_POWER), 0, MAX_CHAMBER_POWER);
       }
@@ -1716,6 +2213,12 @@ void Temperature::manage_heater() {
     #warning "Safety Alert! Disable IGNORE_THERMOCOUPLE_ERRORS for the final build!"
   #endif
 
+  TERN_(TEMP_HISTORY, temp_history.sample());
+
+  #if ENABLED(MULTI_ZONE_WAIT)
+    if (zone_wait.active()) zone_wait.update();
+  #endif
+
   millis_t ms = millis();
 
   #if HAS_HOTEND
@@ -1732,7 +2235,15 @@ void Temperature::manage_heater() {
         tr_state_machine[e].run(temp_hotend[e].celsius, temp_hotend[e].target, (heater_id_t)e, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
       #endif
 
-      temp_hotend[e].soft_pwm_amount = (temp_hotend[e].celsius > temp_range[e].mintemp || is_preheating(e)) && temp_hotend[e].celsius < temp_range[e].maxtemp ? (int)get_pid_output_hotend(e) >> 1 : 0;
+      #if BOTH(PIDTEMP, PID_CONTROL_LOOPS)
+        const bool pid_due = temp_hotend[e].loop.sample(temp_hotend[e].celsius); // Filter every reading
+      #else
+        constexpr bool pid_due = true;
+      #endif
+      if (!((temp_hotend[e].celsius > temp_range[e].mintemp || is_preheating(e)) && temp_hotend[e].celsius < temp_range[e].maxtemp))
+        temp_hotend[e].soft_pwm_amount = 0;
+      else if (pid_due)
+        temp_hotend[e].soft_pwm_amount = (int)get_pid_output_hotend(e) >> 1;
 
       #if WATCH_HOTENDS
         // Make sure temperature is increasing
@@ -1818,7 +2329,11 @@ void Temperature::manage_heater() {
       #endif
       {
         #if ENABLED(PIDTEMPBED)
-          temp_bed.soft_pwm_amount = WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP) ? (int)get_pid_output_bed() >> 1 : 0;
+          const bool pid_due = TERN1(PID_CONTROL_LOOPS, temp_bed.loop.sample(temp_bed.celsius));
+          if (!WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP))
+            temp_bed.soft_pwm_amount = 0;
+          else if (pid_due)
+            temp_bed.soft_pwm_amount = (int)get_pid_output_bed() >> 1;
         #else
           // Check if temperature is within the correct band
           if (WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP)) {
@@ -1928,7 +2443,11 @@ void Temperature::manage_heater() {
 
     #if ENABLED(PIDTEMPCHAMBER)
       // PIDTEMPCHAMBER doesn't support a CHAMBER_VENT yet.
-      temp_chamber.soft_pwm_amount = WITHIN(temp_chamber.celsius, CHAMBER_MINTEMP, CHAMBER_MAXTEMP) ? (int)get_pid_output_chamber() >> 1 : 0;
+      const bool pid_due = TERN1(PID_CONTROL_LOOPS, temp_chamber.loop.sample(temp_chamber.celsius));
+      if (!WITHIN(temp_chamber.celsius, CHAMBER_MINTEMP, CHAMBER_MAXTEMP))
+        temp_chamber.soft_pwm_amount = 0;
+      else if (pid_due)
+        temp_chamber.soft_pwm_amount = (int)get_pid_output_chamber() >> 1;
     #else
       if (ELAPSED(ms, next_chamber_check_ms)) {
         next_chamber_check_ms = ms + CHAMBER_CHECK_INTERVAL;
@@ -2065,6 +2584,19 @@ void Temperature::manage_heater() {
   }                                                                       \
 }while(0)
 
+/**
+ * Use the fine table for the sensor type, if it has one
+ */
+#if ENABLED(THERMISTOR_FINE_TABLES)
+  #define SCAN_FINE_OR_TABLE(TYPE,TBL,LEN) do{ \
+    celsius_float_t c;                         \
+    if (FineThermistor::to_celsius<TYPE>(raw, c)) return c; \
+    SCAN_THERMISTOR_TABLE(TBL,LEN);            \
+  }while(0)
+#else
+  #define SCAN_FINE_OR_TABLE(TYPE,TBL,LEN) SCAN_THERMISTOR_TABLE(TBL,LEN)
+#endif
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
@@ -2296,6 +2828,13 @@ void Temperature::manage_heater() {
     }
 
     #if HAS_HOTEND_THERMISTOR
+      #if ENABLED(THERMISTOR_FINE_TABLES)
+        celsius_float_t c;
+        #define _FINE_HOTEND(N) case N: if (FineThermistor::to_celsius<CAT(TEMP_SENSOR_, N)>(raw, c)) return c; break;
+        switch (e) { REPEAT(HOTENDS, _FINE_HOTEND) }
+        #undef _FINE_HOTEND
+      #endif
+
       // Thermistor with conversion table?
       const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
       SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
@@ -2311,7 +2850,7 @@ void Temperature::manage_heater() {
     #if TEMP_SENSOR_BED_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_BED, raw);
     #elif TEMP_SENSOR_BED_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_BED, TEMPTABLE_BED_LEN);
+      SCAN_FINE_OR_TABLE(TEMP_SENSOR_BED, TEMPTABLE_BED, TEMPTABLE_BED_LEN);
     #elif TEMP_SENSOR_BED_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_BED_IS_AD8495
@@ -2329,7 +2868,7 @@ void Temperature::manage_heater() {
     #if TEMP_SENSOR_CHAMBER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_CHAMBER, raw);
     #elif TEMP_SENSOR_CHAMBER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN);
+      SCAN_FINE_OR_TABLE(TEMP_SENSOR_CHAMBER, TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN);
     #elif TEMP_SENSOR_CHAMBER_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_CHAMBER_IS_AD8495
@@ -2347,7 +2886,7 @@ void Temperature::manage_heater() {
     #if TEMP_SENSOR_COOLER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_COOLER, raw);
     #elif TEMP_SENSOR_COOLER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_COOLER, TEMPTABLE_COOLER_LEN);
+      SCAN_FINE_OR_TABLE(TEMP_SENSOR_COOLER, TEMPTABLE_COOLER, TEMPTABLE_COOLER_LEN);
     #elif TEMP_SENSOR_COOLER_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_COOLER_IS_AD8495
@@ -2365,7 +2904,7 @@ void Temperature::manage_heater() {
     #if TEMP_SENSOR_PROBE_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_PROBE, raw);
     #elif TEMP_SENSOR_PROBE_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_PROBE, TEMPTABLE_PROBE_LEN);
+      SCAN_FINE_OR_TABLE(TEMP_SENSOR_PROBE, TEMPTABLE_PROBE, TEMPTABLE_PROBE_LEN);
     #elif TEMP_SENSOR_PROBE_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_PROBE_IS_AD8495
@@ -2383,7 +2922,7 @@ void Temperature::manage_heater() {
     #if TEMP_SENSOR_BOARD_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_BOARD, raw);
     #elif TEMP_SENSOR_BOARD_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_BOARD, TEMPTABLE_BOARD_LEN);
+      SCAN_FINE_OR_TABLE(TEMP_SENSOR_BOARD, TEMPTABLE_BOARD, TEMPTABLE_BOARD_LEN);
     #elif TEMP_SENSOR_BOARD_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_BOARD_IS_AD8495
@@ -2405,7 +2944,7 @@ void Temperature::manage_heater() {
     #elif TEMP_SENSOR_REDUNDANT_IS_MAX_TC && REDUNDANT_TEMP_MATCH(SOURCE, E1)
       return TERN(TEMP_SENSOR_REDUNDANT_IS_MAX31865, max31865_1.temperature(raw), (int16_t)raw * 0.25);
     #elif TEMP_SENSOR_REDUNDANT_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_REDUNDANT, TEMPTABLE_REDUNDANT_LEN);
+      SCAN_FINE_OR_TABLE(TEMP_SENSOR_REDUNDANT, TEMPTABLE_REDUNDANT, TEMPTABLE_REDUNDANT_LEN);
     #elif TEMP_SENSOR_REDUNDANT_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_REDUNDANT_IS_AD8495
@@ -2542,6 +3081,18 @@ void Temperature::init() {
     pes_e_position = 0;
   #endif
 
+  #if ENABLED(PID_CONTROL_LOOPS)
+    #if ENABLED(PIDTEMP)
+      constexpr uint16_t hotend_pid_period[] = HOTEND_PID_PERIOD;
+      constexpr uint8_t hotend_pid_filter[] = HOTEND_PID_FILTER;
+      static_assert(COUNT(hotend_pid_period) == HOTENDS, "HOTEND_PID_PERIOD needs a value for each hotend.");
+      static_assert(COUNT(hotend_pid_filter) == HOTENDS, "HOTEND_PID_FILTER needs a value for each hotend.");
+      HOTEND_LOOP() temp_hotend[e].loop.init(hotend_pid_period[e], hotend_pid_filter[e]);
+    #endif
+    TERN_(PIDTEMPBED, temp_bed.loop.init(BED_PID_PERIOD, BED_PID_FILTER));
+    TERN_(PIDTEMPCHAMBER, temp_chamber.loop.init(CHAMBER_PID_PERIOD, CHAMBER_PID_FILTER));
+  #endif
+
   // Init (and disable) SPI thermocouples
   #if TEMP_SENSOR_IS_ANY_MAX_TC(0) && PIN_EXISTS(TEMP_0_CS)
     OUT_WRITE(TEMP_0_CS_PIN, HIGH);
@@ -3261,30 +3812,38 @@ void Temperature::disable_all_heaters() {
  */
 void Temperature::update_raw_temperatures() {
 
+  #if ENABLED(ADC_CONTINUOUS_SCAN)
+    // Filter the scan buffer once for all the sensors
+    adc_scan.filter();
+    #define UPDATE_TEMP(OBJ, S) OBJ.setraw(adc_scan.value(ADC_SCAN_##S))
+  #else
+    #define UPDATE_TEMP(OBJ, S) OBJ.update()
+  #endif
+
   // TODO: can this be collapsed into a HOTEND_LOOP()?
   #if HAS_TEMP_ADC_0 && !TEMP_SENSOR_0_IS_MAX_TC
-    temp_hotend[0].update();
+    UPDATE_TEMP(temp_hotend[0], TEMP_0);
   #endif
 
   #if HAS_TEMP_ADC_1 && !TEMP_SENSOR_1_IS_MAX_TC
-    temp_hotend[1].update();
+    UPDATE_TEMP(temp_hotend[1], TEMP_1);
   #endif
 
   #if HAS_TEMP_ADC_REDUNDANT && !TEMP_SENSOR_REDUNDANT_IS_MAX_TC
-    temp_redundant.update();
+    UPDATE_TEMP(temp_redundant, TEMP_REDUNDANT);
   #endif
 
-  TERN_(HAS_TEMP_ADC_2,       temp_hotend[2].update());
-  TERN_(HAS_TEMP_ADC_3,       temp_hotend[3].update());
-  TERN_(HAS_TEMP_ADC_4,       temp_hotend[4].update());
-  TERN_(HAS_TEMP_ADC_5,       temp_hotend[5].update());
-  TERN_(HAS_TEMP_ADC_6,       temp_hotend[6].update());
-  TERN_(HAS_TEMP_ADC_7,       temp_hotend[7].update());
-  TERN_(HAS_TEMP_ADC_BED,     temp_bed.update());
-  TERN_(HAS_TEMP_ADC_CHAMBER, temp_chamber.update());
-  TERN_(HAS_TEMP_ADC_PROBE,   temp_probe.update());
-  TERN_(HAS_TEMP_ADC_COOLER,  temp_cooler.update());
-  TERN_(HAS_TEMP_ADC_BOARD,   temp_board.update());
+  TERN_(HAS_TEMP_ADC_2,       UPDATE_TEMP(temp_hotend[2], TEMP_2));
+  TERN_(HAS_TEMP_ADC_3,       UPDATE_TEMP(temp_hotend[3], TEMP_3));
+  TERN_(HAS_TEMP_ADC_4,       UPDATE_TEMP(temp_hotend[4], TEMP_4));
+  TERN_(HAS_TEMP_ADC_5,       UPDATE_TEMP(temp_hotend[5], TEMP_5));
+  TERN_(HAS_TEMP_ADC_6,       UPDATE_TEMP(temp_hotend[6], TEMP_6));
+  TERN_(HAS_TEMP_ADC_7,       UPDATE_TEMP(temp_hotend[7], TEMP_7));
+  TERN_(HAS_TEMP_ADC_BED,     UPDATE_TEMP(temp_bed,       TEMP_BED));
+  TERN_(HAS_TEMP_ADC_CHAMBER, UPDATE_TEMP(temp_chamber,   TEMP_CHAMBER));
+  TERN_(HAS_TEMP_ADC_PROBE,   UPDATE_TEMP(temp_probe,     TEMP_PROBE));
+  TERN_(HAS_TEMP_ADC_COOLER,  UPDATE_TEMP(temp_cooler,    TEMP_COOLER));
+  TERN_(HAS_TEMP_ADC_BOARD,   UPDATE_TEMP(temp_board,     TEMP_BOARD));
 
   TERN_(HAS_JOY_ADC_X, joystick.x.update());
   TERN_(HAS_JOY_ADC_Y, joystick.y.update());
@@ -3340,7 +3899,13 @@ void Temperature::readings_ready() {
 HAL_TEMP_TIMER_ISR() {
   HAL_timer_isr_prologue(MF_TIMER_TEMP);
 
-  Temperature::isr();
+  #if ENABLED(ISR_CYCLE_STATS)
+    const uint32_t isr_start_cycles = ISRStats::start();
+    Temperature::isr();
+    ISRStats::sample(ISR_STAT_TEMPERATURE, isr_start_cycles);
+  #else
+    Temperature::isr();
+  #endif
 
   HAL_timer_isr_epilogue(MF_TIMER_TEMP);
 }
@@ -3732,75 +4297,79 @@ void Temperature::isr() {
       }
       break;
 
-    #if HAS_TEMP_ADC_0
-      case PrepareTemp_0: hal.adc_start(TEMP_0_PIN); break;
-      case MeasureTemp_0: ACCUMULATE_ADC(temp_hotend[0]); break;
-    #endif
+    #if DISABLED(ADC_CONTINUOUS_SCAN)
 
-    #if HAS_TEMP_ADC_BED
-      case PrepareTemp_BED: hal.adc_start(TEMP_BED_PIN); break;
-      case MeasureTemp_BED: ACCUMULATE_ADC(temp_bed); break;
-    #endif
+      #if HAS_TEMP_ADC_0
+        case PrepareTemp_0: hal.adc_start(TEMP_0_PIN); break;
+        case MeasureTemp_0: ACCUMULATE_ADC(temp_hotend[0]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_CHAMBER
-      case PrepareTemp_CHAMBER: hal.adc_start(TEMP_CHAMBER_PIN); break;
-      case MeasureTemp_CHAMBER: ACCUMULATE_ADC(temp_chamber); break;
-    #endif
+      #if HAS_TEMP_ADC_BED
+        case PrepareTemp_BED: hal.adc_start(TEMP_BED_PIN); break;
+        case MeasureTemp_BED: ACCUMULATE_ADC(temp_bed); break;
+      #endif
 
-    #if HAS_TEMP_ADC_COOLER
-      case PrepareTemp_COOLER: hal.adc_start(TEMP_COOLER_PIN); break;
-      case MeasureTemp_COOLER: ACCUMULATE_ADC(temp_cooler); break;
-    #endif
+      #if HAS_TEMP_ADC_CHAMBER
+        case PrepareTemp_CHAMBER: hal.adc_start(TEMP_CHAMBER_PIN); break;
+        case MeasureTemp_CHAMBER: ACCUMULATE_ADC(temp_chamber); break;
+      #endif
 
-    #if HAS_TEMP_ADC_PROBE
-      case PrepareTemp_PROBE: hal.adc_start(TEMP_PROBE_PIN); break;
-      case MeasureTemp_PROBE: ACCUMULATE_ADC(temp_probe); break;
-    #endif
+      #if HAS_TEMP_ADC_COOLER
+        case PrepareTemp_COOLER: hal.adc_start(TEMP_COOLER_PIN); break;
+        case MeasureTemp_COOLER: ACCUMULATE_ADC(temp_cooler); break;
+      #endif
 
-    #if HAS_TEMP_ADC_BOARD
-      case PrepareTemp_BOARD: hal.adc_start(TEMP_BOARD_PIN); break;
-      case MeasureTemp_BOARD: ACCUMULATE_ADC(temp_board); break;
-    #endif
+      #if HAS_TEMP_ADC_PROBE
+        case PrepareTemp_PROBE: hal.adc_start(TEMP_PROBE_PIN); break;
+        case MeasureTemp_PROBE: ACCUMULATE_ADC(temp_probe); break;
+      #endif
 
-    #if HAS_TEMP_ADC_REDUNDANT
-      case PrepareTemp_REDUNDANT: hal.adc_start(TEMP_REDUNDANT_PIN); break;
-      case MeasureTemp_REDUNDANT: ACCUMULATE_ADC(temp_redundant); break;
-    #endif
+      #if HAS_TEMP_ADC_BOARD
+        case PrepareTemp_BOARD: hal.adc_start(TEMP_BOARD_PIN); break;
+        case MeasureTemp_BOARD: ACCUMULATE_ADC(temp_board); break;
+      #endif
 
-    #if HAS_TEMP_ADC_1
-      case PrepareTemp_1: hal.adc_start(TEMP_1_PIN); break;
-      case MeasureTemp_1: ACCUMULATE_ADC(temp_hotend[1]); break;
-    #endif
+      #if HAS_TEMP_ADC_REDUNDANT
+        case PrepareTemp_REDUNDANT: hal.adc_start(TEMP_REDUNDANT_PIN); break;
+        case MeasureTemp_REDUNDANT: ACCUMULATE_ADC(temp_redundant); break;
+      #endif
 
-    #if HAS_TEMP_ADC_2
-      case PrepareTemp_2: hal.adc_start(TEMP_2_PIN); break;
-      case MeasureTemp_2: ACCUMULATE_ADC(temp_hotend[2]); break;
-    #endif
+      #if HAS_TEMP_ADC_1
+        case PrepareTemp_1: hal.adc_start(TEMP_1_PIN); break;
+        case MeasureTemp_1: ACCUMULATE_ADC(temp_hotend[1]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_3
-      case PrepareTemp_3: hal.adc_start(TEMP_3_PIN); break;
-      case MeasureTemp_3: ACCUMULATE_ADC(temp_hotend[3]); break;
-    #endif
+      #if HAS_TEMP_ADC_2
+        case PrepareTemp_2: hal.adc_start(TEMP_2_PIN); break;
+        case MeasureTemp_2: ACCUMULATE_ADC(temp_hotend[2]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_4
-      case PrepareTemp_4: hal.adc_start(TEMP_4_PIN); break;
-      case MeasureTemp_4: ACCUMULATE_ADC(temp_hotend[4]); break;
-    #endif
+      #if HAS_TEMP_ADC_3
+        case PrepareTemp_3: hal.adc_start(TEMP_3_PIN); break;
+        case MeasureTemp_3: ACCUMULATE_ADC(temp_hotend[3]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_5
-      case PrepareTemp_5: hal.adc_start(TEMP_5_PIN); break;
-      case MeasureTemp_5: ACCUMULATE_ADC(temp_hotend[5]); break;
-    #endif
+      #if HAS_TEMP_ADC_4
+        case PrepareTemp_4: hal.adc_start(TEMP_4_PIN); break;
+        case MeasureTemp_4: ACCUMULATE_ADC(temp_hotend[4]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_6
-      case PrepareTemp_6: hal.adc_start(TEMP_6_PIN); break;
-      case MeasureTemp_6: ACCUMULATE_ADC(temp_hotend[6]); break;
-    #endif
+      #if HAS_TEMP_ADC_5
+        case PrepareTemp_5: hal.adc_start(TEMP_5_PIN); break;
+        case MeasureTemp_5: ACCUMULATE_ADC(temp_hotend[5]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_7
-      case PrepareTemp_7: hal.adc_start(TEMP_7_PIN); break;
-      case MeasureTemp_7: ACCUMULATE_ADC(temp_hotend[7]); break;
-    #endif
+      #if HAS_TEMP_ADC_6
+        case PrepareTemp_6: hal.adc_start(TEMP_6_PIN); break;
+        case MeasureTemp_6: ACCUMULATE_ADC(temp_hotend[6]); break;
+      #endif
+
+      #if HAS_TEMP_ADC_7
+        case PrepareTemp_7: hal.adc_start(TEMP_7_PIN); break;
+        case MeasureTemp_7: ACCUMULATE_ADC(temp_hotend[7]); break;
+      #endif
+
+    #endif // !ADC_CONTINUOUS_SCAN
 
     #if ENABLED(FILAMENT_WIDTH_SENSOR)
       case Prepare_FILWIDTH: hal.adc_start(FILWIDTH_PIN); break;
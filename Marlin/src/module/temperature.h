@@ -111,47 +111,49 @@ hotend_pid_t;
  */
 enum ADCSensorState : char {
   StartSampling,
-  #if HAS_TEMP_ADC_0
-    PrepareTemp_0, MeasureTemp_0,
-  #endif
-  #if HAS_TEMP_ADC_BED
-    PrepareTemp_BED, MeasureTemp_BED,
-  #endif
-  #if HAS_TEMP_ADC_CHAMBER
-    PrepareTemp_CHAMBER, MeasureTemp_CHAMBER,
-  #endif
-  #if HAS_TEMP_ADC_COOLER
-    PrepareTemp_COOLER, MeasureTemp_COOLER,
-  #endif
-  #if HAS_TEMP_ADC_PROBE
-    PrepareTemp_PROBE, MeasureTemp_PROBE,
-  #endif
-  #if HAS_TEMP_ADC_BOARD
-    PrepareTemp_BOARD, MeasureTemp_BOARD,
-  #endif
-  #if HAS_TEMP_ADC_REDUNDANT
-    PrepareTemp_REDUNDANT, MeasureTemp_REDUNDANT,
-  #endif
-  #if HAS_TEMP_ADC_1
-    PrepareTemp_1, MeasureTemp_1,
-  #endif
-  #if HAS_TEMP_ADC_2
-    PrepareTemp_2, MeasureTemp_2,
-  #endif
-  #if HAS_TEMP_ADC_3
-    PrepareTemp_3, MeasureTemp_3,
-  #endif
-  #if HAS_TEMP_ADC_4
-    PrepareTemp_4, MeasureTemp_4,
-  #endif
-  #if HAS_TEMP_ADC_5
-    PrepareTemp_5, MeasureTemp_5,
-  #endif
-  #if HAS_TEMP_ADC_6
-    PrepareTemp_6, MeasureTemp_6,
-  #endif
-  #if HAS_TEMP_ADC_7
-    PrepareTemp_7, MeasureTemp_7,
+  #if DISABLED(ADC_CONTINUOUS_SCAN)   // Temperatures are taken from the scan
+    #if HAS_TEMP_ADC_0
+      PrepareTemp_0, MeasureTemp_0,
+    #endif
+    #if HAS_TEMP_ADC_BED
+      PrepareTemp_BED, MeasureTemp_BED,
+    #endif
+    #if HAS_TEMP_ADC_CHAMBER
+      PrepareTemp_CHAMBER, MeasureTemp_CHAMBER,
+    #endif
+    #if HAS_TEMP_ADC_COOLER
+      PrepareTemp_COOLER, MeasureTemp_COOLER,
+    #endif
+    #if HAS_TEMP_ADC_PROBE
+      PrepareTemp_PROBE, MeasureTemp_PROBE,
+    #endif
+    #if HAS_TEMP_ADC_BOARD
+      PrepareTemp_BOARD, MeasureTemp_BOARD,
+    #endif
+    #if HAS_TEMP_ADC_REDUNDANT
+      PrepareTemp_REDUNDANT, MeasureTemp_REDUNDANT,
+    #endif
+    #if HAS_TEMP_ADC_1
+      PrepareTemp_1, MeasureTemp_1,
+    #endif
+    #if HAS_TEMP_ADC_2
+      PrepareTemp_2, MeasureTemp_2,
+    #endif
+    #if HAS_TEMP_ADC_3
+      PrepareTemp_3, MeasureTemp_3,
+    #endif
+    #if HAS_TEMP_ADC_4
+      PrepareTemp_4, MeasureTemp_4,
+    #endif
+    #if HAS_TEMP_ADC_5
+      PrepareTemp_5, MeasureTemp_5,
+    #endif
+    #if HAS_TEMP_ADC_6
+      PrepareTemp_6, MeasureTemp_6,
+    #endif
+    #if HAS_TEMP_ADC_7
+      PrepareTemp_7, MeasureTemp_7,
+    #endif
   #endif
   #if HAS_JOY_ADC_X
     PrepareJoy_X, MeasureJoy_X,
@@ -233,10 +235,57 @@ typedef struct HeaterInfo : public TempInfo {
   uint8_t soft_pwm_amount;
 } heater_info_t;
 
+#if ENABLED(PID_CONTROL_LOOPS)
+  // The schedule and input filter of a PID loop
+  typedef struct PIDLoop {
+    uint8_t rounds = 1,   // Loop period in ADC rounds (PID_dT)
+            shift = 0,    // Filter strength. Each reading moves the input 1/2^shift of the way.
+            countdown = 0;
+    bool primed = false;
+    int32_t acc;          // Filter state, 1/256 °C << shift
+
+    void init(const uint16_t period_ms, const uint8_t filter) {
+      rounds = constrain(LROUND(period_ms / (PID_dT * 1000)), 1, 255);
+      shift = _MIN(filter, 7);
+      countdown = 0;
+      primed = false;
+    }
+
+    // Filter a reading. Call once per ADC round. Return true when the loop is due.
+    bool sample(const celsius_float_t c) {
+      const int32_t x = LROUND(c * 256);
+      if (primed) acc += x - (acc >> shift); else { acc = x << shift; primed = true; }
+      if (countdown) { countdown--; return false; }
+      countdown = rounds - 1;
+      return true;
+    }
+
+    // The filtered reading
+    celsius_float_t input() const { return (acc >> shift) * (1.0f / 256); }
+  } pid_loop_t;
+#endif
+
+#if ENABLED(PID_CHAMBER_FEEDFORWARD)
+  // Feed-forward from the difference between a zone's target and the chamber
+  typedef struct ChamberFF {
+    float Ka[2] = { 0 };        // Power per °C the target is above (0) or below (1) the chamber
+    bool settling = false;
+    millis_t settle_ms;
+
+    // Feed-forward power for a target 'delta' °C from the chamber
+    float output(const float delta) const { return Ka[delta < 0] * ABS(delta); }
+
+    // Learn Ka from the loop output while the zone holds its target
+    void learn(const float delta, const float error, const float power);
+  } chamber_ff_t;
+#endif
+
 // A heater with PID stabilization
 template<typename T>
 struct PIDHeaterInfo : public HeaterInfo {
   T pid;  // Initialized by settings.load()
+  TERN_(PID_CONTROL_LOOPS, pid_loop_t loop);
+  TERN_(PID_CHAMBER_FEEDFORWARD, chamber_ff_t ff);
 };
 
 #if ENABLED(MPCTEMP)
@@ -952,6 +1001,12 @@ class Temperature {
 
       static void PID_autotune(const celsius_t target, const heater_id_t heater_id, const int8_t ncycles, const bool set_result=false);
 
+      #if ENABLED(PID_STEP_AUTOTUNE)
+        #define PID_STEP_ZONES (TERN0(PIDTEMP, HOTENDS) + ENABLED(PIDTEMPBED) + ENABLED(PIDTEMPCHAMBER))
+        typedef struct { heater_id_t id; celsius_t target; } step_tune_zone_t;
+        static void PID_step_autotune(const step_tune_zone_t zones[], const uint8_t count, const bool set_result=false);
+      #endif
+
       #if ENABLED(NO_FAN_SLOWING_IN_PID_TUNING)
         static bool adaptive_fan_slowing;
       #elif ENABLED(ADAPTIVE_FAN_SLOWING)
@@ -0,0 +1,142 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * thermistor/fine_table.h - Fine thermistor tables (THERMISTOR_FINE_TABLES)
+ *
+ * For each sensor type with known R25, beta and pull-up, a table of temperatures
+ * in 1/32 °C at 2^THERMISTOR_FINE_TABLE_BITS + 1 raw values, evenly spaced over the
+ * whole oversampled ADC range, is computed at compile time with the same model as
+ * custom thermistors (type 1000). A reading is converted with one index and an
+ * integer interpolation, with no search and no float divide.
+ */
+
+#if __cplusplus < 201402L
+  #error "THERMISTOR_FINE_TABLES requires C++14 or newer."
+#endif
+
+namespace FineThermistor {
+
+  constexpr uint16_t TABLE_SIZE = _BV(THERMISTOR_FINE_TABLE_BITS);
+  constexpr uint32_t RAW_RANGE = uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1,
+                     RAW_STEP = RAW_RANGE / TABLE_SIZE;
+
+  static_assert(!(RAW_RANGE & (RAW_RANGE - 1)), "THERMISTOR_FINE_TABLES requires a power of 2 raw ADC range.");
+  static_assert(RAW_STEP >= 1, "THERMISTOR_FINE_TABLE_BITS is too large for the ADC range.");
+
+  constexpr int16_t SCALE = 32;   // Table units per °C
+
+  typedef struct { int16_t value[TABLE_SIZE + 1]; } table_t;
+
+  // Natural log, for use at compile time
+  constexpr double ln(double x) {
+    int k = 0;
+    while (x >= 2) { x /= 2; k++; }
+    while (x < 1) { x *= 2; k--; }
+    const double y = (x - 1) / (x + 1), y2 = y * y;
+    double sum = 0, term = y;
+    for (int n = 1; n < 40; n += 2) { sum += term / n; term *= y2; }
+    return 2 * sum + k * 0.69314718055994530942;
+  }
+
+  // The model used by Temperature::user_thermistor_to_deg_c, at each table raw value
+  constexpr table_t make_table(const double r25, const double beta, const double pullup, const double sh_c) {
+    table_t t{};
+    const double adc_max = MAX_RAW_THERMISTOR_VALUE,
+                 l25 = ln(r25),
+                 alpha = 1.0 / (THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C)) - l25 / beta - sh_c * l25 * l25 * l25;
+    for (uint16_t i = 0; i <= TABLE_SIZE; i++) {
+      double raw = double(i) * RAW_STEP;
+      if (raw < 1) raw = 1;
+      if (raw > adc_max - 1) raw = adc_max - 1;
+      const double lr = ln(pullup * (raw + 0.5) / ((adc_max - raw) - 0.5));
+      double c = 1.0 / (alpha + lr / beta + sh_c * lr * lr * lr) + THERMISTOR_ABS_ZERO_C;
+      if (c > 999) c = 999;
+      if (c < -273) c = -273;
+      t.value[i] = int16_t(c * SCALE + (c < 0 ? -0.5 : 0.5));
+    }
+    return t;
+  }
+
+  // R25, beta and pull-up of the sensor types, from each thermistor_N.h
+  template<int TYPE> struct params_t { static constexpr bool known = false; };
+
+  #define FINE_THERMISTOR(TYPE, R25, BETA, PULLUP) \
+    template<> struct params_t<TYPE> { \
+      static constexpr bool known = true; \
+      static constexpr double r25 = R25, beta = BETA, pullup = PULLUP, sh_c = 0; \
+    };
+
+  FINE_THERMISTOR(   1,  100000, 4092, 4700)
+  FINE_THERMISTOR(   2,  200000, 4338, 4700)
+  FINE_THERMISTOR(   3,  100000, 4120, 4700)
+  FINE_THERMISTOR(   4,   10000, 3950, 4700)
+  FINE_THERMISTOR(   5,  100000, 4267, 4700)
+  FINE_THERMISTOR(   6,  100000, 4092, 8200)
+  FINE_THERMISTOR(   7,  100000, 3974, 4700)
+  FINE_THERMISTOR(   8,  100000, 3950, 10000)
+  FINE_THERMISTOR(   9,  100000, 3960, 4700)
+  FINE_THERMISTOR(  10,  100000, 3960, 4700)
+  FINE_THERMISTOR(  11,  100000, 3950, 4700)
+  FINE_THERMISTOR(  12,  100000, 4700, 4700)
+  FINE_THERMISTOR(  13,  100000, 4100, 4700)
+  FINE_THERMISTOR(  30,  100000, 3950, 4700)
+  FINE_THERMISTOR(  51,  100000, 4092, 1000)
+  FINE_THERMISTOR(  52,  200000, 4338, 1000)
+  FINE_THERMISTOR(  55,  100000, 4267, 1000)
+  FINE_THERMISTOR(  60,  100000, 3950, 4700)
+  FINE_THERMISTOR(  61,  100000, 3950, 4700)
+  FINE_THERMISTOR(  66, 2500000, 4500, 4700)
+  FINE_THERMISTOR(  67,  500000, 3800, 4700)
+  FINE_THERMISTOR(  70,  100000, 4100, 4700)
+  FINE_THERMISTOR(  71,  100000, 3974, 4700)
+  FINE_THERMISTOR(2000,  100000, 4550, 4700)
+
+  #undef FINE_THERMISTOR
+
+  template<int TYPE, bool = params_t<TYPE>::known>
+  struct converter_t {
+    static bool to_celsius(const raw_adc_t, celsius_float_t&) { return false; }
+  };
+
+  template<int TYPE>
+  struct converter_t<TYPE, true> {
+    typedef params_t<TYPE> P;
+    static constexpr table_t table PROGMEM = make_table(P::r25, P::beta, P::pullup, P::sh_c);
+
+    static bool to_celsius(const raw_adc_t raw, celsius_float_t &out) {
+      const uint16_t i = raw / RAW_STEP, f = raw % RAW_STEP;
+      const int16_t v0 = pgm_read_word(&table.value[i]), v1 = pgm_read_word(&table.value[i + 1]);
+      out = (v0 + int32_t(v1 - v0) * f / int32_t(RAW_STEP)) * (1.0f / SCALE);
+      return true;
+    }
+  };
+
+  template<int TYPE>
+  constexpr table_t converter_t<TYPE, true>::table;
+
+  // Convert with the fine table for the sensor type. Return false if there isn't one.
+  template<int TYPE>
+  inline bool to_celsius(const raw_adc_t raw, celsius_float_t &out) { return converter_t<TYPE>::to_celsius(raw, out); }
+
+} // FineThermistor
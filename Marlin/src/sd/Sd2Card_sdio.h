@@ -28,6 +28,7 @@
 
 bool SDIO_Init();
 bool SDIO_ReadBlock(uint32_t block, uint8_t *dst);
+bool SDIO_ReadBlocks(uint32_t block, uint8_t *dst, const uint16_t count);
 bool SDIO_WriteBlock(uint32_t block, const uint8_t *src);
 bool SDIO_IsReady();
 uint32_t SDIO_GetCardSize();
@@ -47,6 +48,7 @@ class DiskIODriver_SDIO : public DiskIODriver {
     bool writeStop()                                      override { curBlock = -1; return true; }
 
     bool readBlock(uint32_t block, uint8_t *dst)          override { return SDIO_ReadBlock(block, dst); }
+    bool readBlocks(uint32_t block, uint8_t *dst, const uint16_t count) override { return SDIO_ReadBlocks(block, dst, count); }
     bool writeBlock(uint32_t block, const uint8_t *src)   override { return SDIO_WriteBlock(block, src); }
 
     uint32_t cardSize()                                   override { return SDIO_GetCardSize(); }
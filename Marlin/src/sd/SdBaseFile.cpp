@@ -1397,8 +1397,19 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
     // amount to be read from current block
     NOMORE(n, 512 - offset);
 
+    // Read whole blocks to the end of the cluster in one transfer
+    uint16_t blocks = 1;
+    if (n == 512 && type_ != FAT_FILE_TYPE_ROOT_FIXED) {
+      blocks = _MIN(toRead >> 9, vol_->blocksPerCluster() - vol_->blockOfCluster(curPosition_));
+      if (vol_->cacheBlockNumber() - block < blocks) blocks = 1;  // The cache may be newer than the media
+    }
+
+    if (blocks > 1) {
+      if (!vol_->readBlocks(block, dst, blocks)) return -1;
+      n = blocks << 9;
+    }
     // no buffering needed if n == 512
-    if (n == 512 && block != vol_->cacheBlockNumber()) {
+    else if (n == 512 && block != vol_->cacheBlockNumber()) {
       if (!vol_->readBlock(block, dst)) return -1;
     }
     else {
@@ -55,6 +55,14 @@
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(SD_HEATSHRINK)
+  #include "../libs/heatshrink/heatshrink_decoder.h"
+#endif
+
+#if ENABLED(SD_LOG)
+  #include "../feature/sd_log.h"
+#endif
+
 #define DEBUG_OUT EITHER(DEBUG_CARDREADER, MARLIN_DEV_MODE)
 #include "../core/debug_out.h"
 #include "../libs/hex_print.h"
@@ -143,6 +151,20 @@ SdFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_READ_AHEAD)
+  uint8_t CardReader::readahead_buf[(SD_READ_AHEAD_BLOCKS) * 512] __attribute__((aligned(4)));
+  uint32_t CardReader::readahead_pos;
+  uint16_t CardReader::readahead_len; // = 0
+#endif
+
+#if ENABLED(SD_HEATSHRINK)
+  uint8_t CardReader::decoded_buf[64], CardReader::decoded_len, CardReader::decoded_index;
+
+  static heatshrink_decoder hsd;
+  static uint8_t hs_input[512] __attribute__((aligned(4)));
+  static uint16_t hs_input_len, hs_input_index;
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -197,6 +219,13 @@ char *createFilename(char * const buffer, const dir_t &p) {
 //
 // Return 'true' if the item is a folder, G-code file or Binary file
 //
+#if ENABLED(SD_HEATSHRINK)
+  // A heatshrink compressed G-code file, e.g., 'part.gcode.hs'
+  static bool is_compressed_name(const dir_t &p) {
+    return p.name[8] == 'H' && p.name[9] == 'S' && p.name[10] == ' ';
+  }
+#endif
+
 bool CardReader::is_visible_entity(const dir_t &p OPTARG(CUSTOM_FIRMWARE_UPLOAD, bool onlyBin/*=false*/)) {
   //uint8_t pn0 = p.name[0];
 
@@ -221,6 +250,9 @@ bool CardReader::is_visible_entity(const dir_t &p OPTARG(CUSTOM_FIRMWARE_UPLOAD,
     || fileIsBinary()                                   // BIN files are accepted
     || (!onlyBin && p.name[8] == 'G'
                  && p.name[9] != '~')                   // Non-backup *.G* files are accepted
+    #if ENABLED(SD_HEATSHRINK)
+      || (!onlyBin && is_compressed_name(p))            // *.HS compressed G-code files are accepted
+    #endif
   );
 }
 
@@ -534,6 +566,8 @@ void CardReader::release() {
   else
     endFilePrintNow();
 
+  TERN_(SD_LOG, sd_log.stop());
+
   flag.mounted = false;
   flag.workDirIsRoot = true;
   #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
@@ -681,6 +715,13 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(SD_READ_AHEAD, readahead_len = 0);
+
+    #if ENABLED(SD_HEATSHRINK)
+      dir_t d;
+      flag.compressed = file.dirEntry(&d) && is_compressed_name(d);
+      if (flag.compressed) seekDecoded(0);
+    #endif
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -782,7 +823,7 @@ void CardReader::removeFile(const char * const name) {
 
 void CardReader::report_status() {
   if (isPrinting()) {
-    SERIAL_ECHOPGM(STR_SD_PRINTING_BYTE, sdpos);
+    SERIAL_ECHOPGM(STR_SD_PRINTING_BYTE, getProgressIndex());
     SERIAL_CHAR('/');
     SERIAL_ECHOLN(filesize);
   }
@@ -851,6 +892,94 @@ void CardReader::write_command(char * const buf) {
   }
 #endif
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Refill the read-ahead buffer starting at sdpos. A fill from the middle
+   * of a block only reads to the end of that block, so later fills are
+   * block aligned and whole blocks up to the end of each cluster are read
+   * straight into the (word aligned) buffer with one multi-block transfer.
+   */
+  bool CardReader::fillReadAhead() {
+    readahead_len = 0;
+    if (!file.isOpen()) return false;
+    if (file.curPosition() != sdpos && !file.seekSet(sdpos)) return false;
+    const uint16_t offset = sdpos & 0x1FF;
+    const int16_t n = file.read(readahead_buf, offset ? 512 - offset : sizeof(readahead_buf));
+    if (n <= 0) return false;
+    readahead_pos = sdpos;
+    readahead_len = n;
+    return true;
+  }
+
+  // Put the file position back at sdpos for direct reads
+  void CardReader::dropReadAhead() {
+    if (readahead_len) {
+      file.seekSet(sdpos);
+      readahead_len = 0;
+    }
+  }
+
+#endif
+
+#if ENABLED(SD_HEATSHRINK)
+
+  /**
+   * Decode the next run of bytes from the compressed file.
+   * Return false at the end of the data or on a read error.
+   */
+  bool CardReader::fillDecoded() {
+    decoded_len = decoded_index = 0;
+    bool finished = false;
+    for (;;) {
+      size_t count;
+      if (heatshrink_decoder_poll(&hsd, decoded_buf, sizeof(decoded_buf), &count) < 0) return false;
+      if (count) { decoded_len = count; return true; }
+
+      // The decoder needs more input
+      if (hs_input_index >= hs_input_len) {
+        const int16_t n = file.read(hs_input, sizeof(hs_input));
+        if (n <= 0) {
+          // Flush anything left in the decoder once, then stop
+          if (finished) return false;
+          finished = true;
+          heatshrink_decoder_finish(&hsd);
+          continue;
+        }
+        hs_input_len = n;
+        hs_input_index = 0;
+      }
+
+      if (heatshrink_decoder_sink(&hsd, &hs_input[hs_input_index], hs_input_len - hs_input_index, &count) < 0) return false;
+      hs_input_index += count;
+    }
+  }
+
+  /**
+   * Seek to a decompressed position. Going back means decoding again from
+   * the start of the file, so this is slow for large files.
+   */
+  void CardReader::seekDecoded(const uint32_t index) {
+    if (index < sdpos || index == 0) {
+      heatshrink_decoder_reset(&hsd);
+      hs_input_len = hs_input_index = 0;
+      decoded_len = decoded_index = 0;
+      file.seekSet(0);
+      sdpos = 0;
+    }
+    while (sdpos < index) {
+      if (decoded_index >= decoded_len) {
+        if (!fillDecoded()) break;
+        watchdog_refresh();
+      }
+      const uint8_t n = _MIN(uint32_t(decoded_len - decoded_index), index - sdpos);
+      decoded_index += n;
+      sdpos += n;
+    }
+  }
+
+#endif
+
 void CardReader::closefile(const bool store_location/*=false*/) {
   file.sync();
   file.close();
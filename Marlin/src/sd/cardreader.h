@@ -86,6 +86,9 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1
        #endif
+       #if ENABLED(SD_HEATSHRINK)
+         , compressed:1
+       #endif
     ;
 } card_flags_t;
 
@@ -173,13 +176,13 @@ public:
   #if HAS_PRINT_PROGRESS_PERMYRIAD
     static uint16_t permyriadDone() {
       if (flag.sdprintdone) return 10000;
-      if (isFileOpen() && filesize) return sdpos / ((filesize + 9999) / 10000);
+      if (isFileOpen() && filesize) return getProgressIndex() / ((filesize + 9999) / 10000);
       return 0;
     }
   #endif
   static uint8_t percentDone() {
     if (flag.sdprintdone) return 100;
-    if (isFileOpen() && filesize) return sdpos / ((filesize + 99) / 100);
+    if (isFileOpen() && filesize) return getProgressIndex() / ((filesize + 99) / 100);
     return 0;
   }
 
@@ -233,13 +236,66 @@ public:
   static uint32_t getFileSize()  { return filesize; }
   static uint32_t getIndex()     { return sdpos; }
   static bool isFileOpen()       { return isMounted() && file.isOpen(); }
-  static bool eof()              { return getIndex() >= getFileSize(); }
+  static bool eof() {
+    #if ENABLED(SD_HEATSHRINK)
+      if (flag.compressed) return decoded_index >= decoded_len && !fillDecoded();
+    #endif
+    return getIndex() >= getFileSize();
+  }
+
+  // Print progress, by the position in the file itself for compressed files
+  static uint32_t getProgressIndex() { return TERN0(SD_HEATSHRINK, flag.compressed) ? file.curPosition() : sdpos; }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  static int16_t get() {
+    #if ENABLED(SD_HEATSHRINK)
+      if (flag.compressed) {
+        if (decoded_index >= decoded_len && !fillDecoded()) return -1;
+        sdpos++;
+        return decoded_buf[decoded_index++];
+      }
+    #endif
+    #if ENABLED(SD_READ_AHEAD)
+      uint32_t i = sdpos - readahead_pos;
+      if (i >= readahead_len) {
+        if (!fillReadAhead()) return -1;
+        i = 0;
+      }
+      sdpos++;
+      return readahead_buf[i];
+    #else
+      int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out;
+    #endif
+  }
+
+  static void setIndex(const uint32_t index) {
+    #if ENABLED(SD_HEATSHRINK)
+      if (flag.compressed) return seekDecoded(index);
+    #endif
+    #if ENABLED(SD_READ_AHEAD)
+      sdpos = index;                // The next fill seeks if needed
+    #else
+      file.seekSet((sdpos = index));
+    #endif
+  }
+
+  #if ENABLED(SD_READ_AHEAD)
+    // The buffered bytes that get() hasn't reached yet, for looking ahead
+    static uint16_t peekAhead(const uint8_t* &buf) {
+      if (TERN0(SD_HEATSHRINK, flag.compressed)) return 0;
+      const uint32_t i = sdpos - readahead_pos;
+      if (i >= readahead_len) return 0;
+      buf = readahead_buf + i;
+      return readahead_len - i;
+    }
+  #endif
+
+  #if ENABLED(SD_READ_AHEAD)
+    static int16_t read(void *buf, uint16_t nbyte)  { if (!file.isOpen()) return -1; dropReadAhead(); return file.read(buf, nbyte); }
+  #else
+    static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  #endif
   static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -263,6 +319,8 @@ public:
   #endif
 
 private:
+  TERN_(SD_LINE_INDEX, friend class SDIndex);
+
   //
   // Working directory and parents
   //
@@ -329,6 +387,28 @@ private:
   static SdVolume volume;
   static SdFile file;
 
+  #if ENABLED(SD_READ_AHEAD)
+    //
+    // Read-ahead buffer for get(), holding the file from readahead_pos
+    //
+    static uint8_t readahead_buf[(SD_READ_AHEAD_BLOCKS) * 512];
+    static uint32_t readahead_pos;
+    static uint16_t readahead_len;
+    static bool fillReadAhead();
+    static void dropReadAhead();
+  #endif
+
+  #if ENABLED(SD_HEATSHRINK)
+    //
+    // Output of the heatshrink decoder for compressed (.HS) files.
+    // sdpos counts decompressed bytes so seeks and M808 loops still work.
+    //
+    static uint8_t decoded_buf[64];
+    static uint8_t decoded_len, decoded_index;
+    static bool fillDecoded();
+    static void seekDecoded(const uint32_t index);
+  #endif
+
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
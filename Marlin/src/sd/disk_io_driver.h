@@ -59,6 +59,17 @@ public:
   virtual bool readBlock(uint32_t block, uint8_t* dst) = 0;
   virtual bool writeBlock(uint32_t blockNumber, const uint8_t* src) = 0;
 
+  /**
+   * Read consecutive blocks into dst. Drivers with a faster way to
+   * transfer several blocks at once should override this.
+   */
+  virtual bool readBlocks(uint32_t block, uint8_t* dst, const uint16_t count) {
+    if (!readStart(block)) return false;
+    for (uint16_t i = 0; i < count; ++i, dst += 512)
+      if (!readData(dst)) { readStop(); return false; }
+    return readStop();
+  }
+
   virtual uint32_t cardSize() = 0;
 
   virtual bool isReady() = 0;
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+#
+# direct_stepping_pack.py
+# Encode step segments as DIRECT_STEPPING page frames for Marlin.
+#
+# Input is a CSV of step counts, one segment per line: "x,y,z,e"
+#   SP_4x4D_128  Signed steps per segment, -7 to 7
+#   SP_4x2_256   Steps per segment, 0 to 3 (direction is set by G6)
+#   SP_4x1_512   Steps per segment, 0 or 1
+#
+# Each page is sent as a run-length compressed '$' frame (DIRECT_STEPPING_RLE)
+# or as a raw '!' frame, whichever is smaller. See feature/direct_stepping.h
+# for the token format.
+#
+# Usage: direct_stepping_pack.py [--format SP_4x2_256] [--pages 16] [--raw] [--verify] input.csv output.bin
+#
+# The output is written to pages 0, 1, 2... in turn. A host sending live
+# should use PageEncoder.frame() with a page the firmware reports free, then
+# issue G6 for it once the firmware reports the page OK.
+#
+import argparse
+import sys
+
+FORMATS = {
+    # name: (bits per segment, directional, segments)
+    'SP_4x4D_128': (4, True, 128),
+    'SP_4x2_256':  (2, False, 256),
+    'SP_4x1_512':  (1, False, 512),
+}
+
+AXIS_COUNT = 4
+
+class PageEncoder:
+    def __init__(self, fmt='SP_4x2_256', rle=True):
+        self.bits, self.directional, self.segments = FORMATS[fmt]
+        self.rle = rle
+        num_segments = 1 << self.bits
+        self.segment_steps = (1 << (self.bits - self.directional)) - 1
+        self.zero = self.segment_steps if self.directional else 0
+        self.max_value = num_segments - 1 - self.directional
+        self.page_size = AXIS_COUNT * self.bits * self.segments // 8
+
+    def values(self, steps):
+        """Convert a page of (x, y, z, e) step counts to per-axis segment values."""
+        steps = list(steps) + [(0,) * AXIS_COUNT] * (self.segments - len(steps))
+        if len(steps) > self.segments: raise ValueError('Too many segments for one page')
+        axes = []
+        for a in range(AXIS_COUNT):
+            col = []
+            for s in steps:
+                v = int(s[a]) + (self.zero if self.directional else 0)
+                if not 0 <= v <= self.max_value: raise ValueError('Step count %d out of range' % int(s[a]))
+                col.append(v)
+            axes.append(col)
+        return axes
+
+    def layout(self, s, a):
+        """Byte index and shift of a segment value, as the stepper reads it."""
+        if self.bits == 4: return s * 2 + (a >> 1), 0 if a & 1 else 4
+        if self.bits == 2: return s, 6 - 2 * a
+        return s >> 1, (s & 1) * 4 + 3 - a
+
+    def raw(self, axes):
+        page = bytearray(self.page_size)
+        for a, col in enumerate(axes):
+            for s, v in enumerate(col):
+                i, shift = self.layout(s, a)
+                page[i] |= v << shift
+        return bytes(page)
+
+    def tokens(self, axes):
+        out = bytearray()
+        for col in axes:
+            cur, s = self.zero, 0
+            while s < len(col):
+                val, n = col[s], 1
+                while s + n < len(col) and col[s + n] == val: n += 1
+                s += n
+                if val != cur:
+                    d = val - cur
+                    if -7 <= d <= 7:
+                        c = min(n, 16)
+                        out.append((d + 8) << 4 | (c - 1))
+                    else:
+                        c = 1
+                        out.append(val)
+                    n -= c
+                    cur = val
+                while n > 16:
+                    c = min(n, 256)
+                    out += bytes([0x0F, c - 1])
+                    n -= c
+                if n: out.append(0x80 | (n - 1))
+        return bytes(out)
+
+    def decode(self, tokens):
+        """Expand tokens the way the firmware does. Returns a raw page, or None on error."""
+        page = bytearray(self.page_size)
+        axis = seg = 0
+        val = self.zero
+        it = iter(tokens)
+        for c in it:
+            if c == 0x0F:
+                count = next(it, None)
+                if count is None: return None
+                count += 1
+            elif c < 0x10:
+                val, count = c, 1
+            else:
+                val, count = val + (c >> 4) - 8, (c & 0xF) + 1
+            if axis >= AXIS_COUNT or not 0 <= val <= self.max_value or seg + count > self.segments: return None
+            for s in range(seg, seg + count):
+                i, shift = self.layout(s, axis)
+                page[i] |= val << shift
+            seg += count
+            if seg == self.segments: axis, seg, val = axis + 1, 0, self.zero
+        return bytes(page) if axis == AXIS_COUNT else None
+
+    @staticmethod
+    def xor(data):
+        cs = 0
+        for b in data: cs ^= b
+        return cs
+
+    def frame(self, page_idx, steps):
+        """Return the frame for a page of (x, y, z, e) step counts."""
+        axes = self.values(steps)
+        data = self.raw(axes)
+        raw = b'\n!' + bytes([page_idx]) + (b'' if self.directional else b'\0') + data + bytes([self.xor(data)])
+        if not self.rle: return raw
+        tok = self.tokens(axes)
+        rle = b'\n$' + bytes([page_idx, len(tok) & 0xFF, len(tok) >> 8]) + tok + bytes([self.xor(tok)])
+        return rle if len(rle) < len(raw) else raw
+
+def read_segments(f):
+    for line in f:
+        line = line.split('#', 1)[0].strip()
+        if not line: continue
+        yield tuple(int(v) for v in line.split(','))
+
+def main():
+    ap = argparse.ArgumentParser(description='Encode step segments as DIRECT_STEPPING page frames')
+    ap.add_argument('--format', default='SP_4x2_256', choices=FORMATS.keys(), help='STEPPER_PAGE_FORMAT')
+    ap.add_argument('--pages', type=int, default=16, help='STEPPER_PAGES')
+    ap.add_argument('--raw', action='store_true', help='Only use raw frames')
+    ap.add_argument('--verify', action='store_true', help='Decode each compressed page and compare')
+    ap.add_argument('input')
+    ap.add_argument('output')
+    args = ap.parse_args()
+
+    enc = PageEncoder(args.format, not args.raw)
+    pages = raw_bytes = out_bytes = 0
+
+    def flush(fout, steps):
+        nonlocal pages, raw_bytes, out_bytes
+        fr = enc.frame(pages % args.pages, steps)
+        if args.verify and fr[1:2] == b'$':
+            axes = enc.values(steps)
+            if enc.decode(enc.tokens(axes)) != enc.raw(axes):
+                sys.exit('Page %d does not decode to its raw data' % pages)
+        fout.write(fr)
+        pages += 1
+        raw_bytes += enc.page_size + 4
+        out_bytes += len(fr)
+
+    with open(args.input) as fin, open(args.output, 'wb') as fout:
+        steps = []
+        for seg in read_segments(fin):
+            if len(seg) != AXIS_COUNT: sys.exit('Expected %d values per line' % AXIS_COUNT)
+            steps.append(seg)
+            if len(steps) == enc.segments:
+                flush(fout, steps)
+                steps = []
+        if steps: flush(fout, steps)
+
+    print('%d pages, %d bytes raw, %d bytes sent (%.1f%%)' % (pages, raw_bytes, out_bytes, 100.0 * out_bytes / max(raw_bytes, 1)), file=sys.stderr)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+#
+# packed_gcode.py
+# Encode G-code as packed frames for Marlin's PACKED_GCODE option.
+#
+# The frame format is described in Marlin/src/feature/packed_gcode.h.
+# Lines that can't be packed (strings, M110, bad syntax) are kept as text.
+#
+# Usage: packed_gcode.py [-n] [--max-size 92] input.gcode output.bin
+#
+#   -n  Number the lines, as a host would. The firmware checks them in
+#       sequence whether they are packed or text.
+#
+# A host sending live should keep one PackedEncoder per port and call
+# rewind() with the last acknowledged line's state after a "Resend:".
+#
+import argparse
+import copy
+import re
+import sys
+
+SYNC = 0xF5
+SCALE = 100000
+
+TYPE_FLAG, TYPE_INT, TYPE_FIXED, TYPE_DELTA = 0, 1, 2, 3
+
+# Commands that take a string, or that must be seen as text
+TEXT_ONLY = { ('M', n) for n in (16, 23, 28, 30, 32, 110, 117, 118, 743, 928) } | { ('M', n) for n in range(810, 820) }
+
+# Always send these as fixed point so later deltas can use them
+FIXED_LETTERS = set('XYZEUVWABCIJKR')
+
+WORD = re.compile(r'([A-Z])\s*([-+]?(?:\d+\.?\d*|\.\d+))?\s*')
+
+def crc16(data, crc=0):
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+def varint(v):
+    out = bytearray()
+    while True:
+        b = v & 0x7F
+        v >>= 7
+        if v:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return out
+
+def zigzag(v):
+    return ((v << 1) ^ (v >> 31)) & 0xFFFFFFFF
+
+def strip(line):
+    line = line.split(';', 1)[0]
+    line = re.sub(r'\*\d*\s*$', '', line)
+    return line.strip()
+
+class PackedEncoder:
+    def __init__(self, max_size=92):
+        self.max_size = max_size
+        self.last = {}                  # Fixed point value of each letter, as the firmware has it
+
+    def state(self):
+        return copy.copy(self.last)
+
+    def rewind(self, state):
+        self.last = copy.copy(state)
+
+    def encode(self, line, n=None):
+        """Return a packed frame, or the text line (with checksum if numbered)."""
+        text = strip(line)
+        if not text: return None
+        frame = self.pack(text, n)
+        if frame is not None: return frame
+        if n is not None:
+            text = 'N%d %s' % (n, text)
+            cs = 0
+            for ch in text: cs ^= ord(ch)
+            text = '%s*%d' % (text, cs)
+        return (text + '\n').encode()
+
+    def pack(self, text, n):
+        m = re.match(r'([GMT])(\d+)(?:\.(\d+))?(?:\s+|$)', text)
+        if not m: return None
+        letter, code, sub = m.group(1), int(m.group(2)), m.group(3)
+        if (letter, code) in TEXT_ONLY or code > 0xFFFF: return None
+
+        flags = 'GMT'.index(letter)
+        body = bytearray()
+        if sub is not None:
+            if int(sub) > 255: return None
+            flags |= 4
+        if n is not None: flags |= 8
+        body.append(flags)
+        if n is not None: body += varint(n)
+        body += varint(code)
+        if sub is not None: body.append(int(sub))
+
+        rest, pos, last = text[m.end():], 0, dict(self.last)
+        values = 0
+        while pos < len(rest):
+            w = WORD.match(rest, pos)
+            if not w or w.end() == pos: return None
+            pos = w.end()
+            p, val = w.group(1), w.group(2)
+            ind = ord(p) - ord('A')
+            if val is None:
+                body.append(ind | TYPE_FLAG << 5)
+                continue
+            values += 1
+            if p not in FIXED_LETTERS and re.fullmatch(r'[-+]?\d+', val):
+                body.append(ind | TYPE_INT << 5)
+                body += varint(zigzag(int(val)))
+                continue
+            fixed = int(round(float(val) * SCALE))
+            if not -2**31 <= fixed < 2**31: return None
+            absolute = varint(zigzag(fixed))
+            if p in last and -2**31 <= fixed - last[p] < 2**31:
+                delta = varint(zigzag(fixed - last[p]))
+                if len(delta) < len(absolute):
+                    body.append(ind | TYPE_DELTA << 5)
+                    body += delta
+                    last[p] = fixed
+                    continue
+            body.append(ind | TYPE_FIXED << 5)
+            body += absolute
+            last[p] = fixed
+
+        # The firmware also stores the command word and a float per value
+        word = len('%s%d' % (letter, code)) + (len('.' + sub) if sub is not None else 0) + (len('N%d ' % n) if n is not None else 0)
+        if len(body) > self.max_size or word + 1 + 12 + 4 * values > self.max_size + 4: return None
+
+        self.last = last
+        head = bytes([len(body)]) + body
+        crc = crc16(head)
+        return bytes([SYNC]) + head + bytes([crc & 0xFF, crc >> 8])
+
+def main():
+    ap = argparse.ArgumentParser(description='Encode G-code as packed frames')
+    ap.add_argument('-n', '--numbered', action='store_true', help='Add line numbers')
+    ap.add_argument('--max-size', type=int, default=92, help='MAX_CMD_SIZE - 4')
+    ap.add_argument('input')
+    ap.add_argument('output')
+    args = ap.parse_args()
+
+    enc = PackedEncoder(args.max_size)
+    n = 1 if args.numbered else None
+    text_bytes = packed_bytes = 0
+    with open(args.input) as fin, open(args.output, 'wb') as fout:
+        for line in fin:
+            out = enc.encode(line, n)
+            if out is None: continue
+            text_bytes += len(strip(line)) + 1
+            packed_bytes += len(out)
+            fout.write(out)
+            if n is not None: n += 1
+
+    print('%d bytes of G-code, %d bytes packed (%.1f%%)' % (text_bytes, packed_bytes, 100.0 * packed_bytes / max(text_bytes, 1)), file=sys.stderr)
+
+if __name__ == '__main__':
+    main()
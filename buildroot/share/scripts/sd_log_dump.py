@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+#
+# sd_log_dump.py
+# Print the records of a Marlin SD_LOG telemetry file as CSV.
+#
+# The record format is described in Marlin/src/feature/sd_log.h.
+# A file can hold several sessions, each starting with a START record
+# that gives the layout of the SAMPLE records that follow.
+#
+# Usage: sd_log_dump.py PRINT.LOG > print.csv
+#
+import struct
+import sys
+
+START, SAMPLE, VALVE, NOTE, STOP = 1, 2, 3, 4, 5
+
+AXIS_NAMES = 'XYZUVWABC'
+
+def dump(data, out):
+    layout = None
+    pos = 0
+    while pos + 6 <= len(data):
+        rtype, size, ms = struct.unpack_from('<BBI', data, pos)
+        if size < 6 or pos + size > len(data):
+            print('# Bad record at offset %d' % pos, file=sys.stderr)
+            break
+        body = data[pos + 6:pos + size]
+        pos += size
+        t = '%.3f' % (ms / 1000.0)
+
+        if rtype == START:
+            version, hotends, bed, chamber, axes, extruder, interval = struct.unpack_from('<BBBBBBH', body)
+            heaters = ['T%d' % e for e in range(hotends)] + (['B'] if bed else []) + (['C'] if chamber else [])
+            names = list(AXIS_NAMES[:axes]) + (['E'] if extruder else [])
+            layout = (heaters, names)
+            cols = ['%s,%s_target' % (h, h) for h in heaters] + names + ['flags']
+            print('start,%s,version=%d,interval=%d' % (t, version, interval), file=out)
+            print('time,' + ','.join(cols), file=out)
+        elif rtype == SAMPLE and layout:
+            heaters, names = layout
+            fmt = '<' + 'hh' * len(heaters) + 'f' * len(names) + 'B'
+            v = struct.unpack_from(fmt, body)
+            temps = ['%.1f,%d' % (v[2 * i] / 10.0, v[2 * i + 1]) for i in range(len(heaters))]
+            axes = ['%.4f' % a for a in v[2 * len(heaters):-1]]
+            print(','.join([t] + temps + axes + [str(v[-1])]), file=out)
+        elif rtype == VALVE:
+            print('valve,%s,%s' % (t, 'open' if body[0] else 'closed'), file=out)
+        elif rtype == NOTE:
+            code, value = struct.unpack_from('<Hf', body)
+            print('note,%s,%d,%g' % (t, code, value), file=out)
+        elif rtype == STOP:
+            print('stop,%s,dropped=%d' % (t, struct.unpack_from('<H', body)[0]), file=out)
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit('Usage: sd_log_dump.py logfile')
+    with open(sys.argv[1], 'rb') as f:
+        dump(f.read(), sys.stdout)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+#
+# temp_history_dump.py
+# Fetch Marlin's TEMP_HISTORY with M746 and print it as CSV.
+#
+# The frame format is described in Marlin/src/feature/temp_history.h.
+#
+# Usage: temp_history_dump.py [-b 250000] [-n count] /dev/ttyACM0 > history.csv
+#
+import argparse
+import struct
+import sys
+
+import serial
+
+NAMES = { -1: 'B', -2: 'C', -3: 'P', -4: 'L', -5: 'M', -6: 'R' }
+
+def crc16(data, crc=0):
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+def fetch(port, count):
+    port.reset_input_buffer()
+    port.write(b'M746' + (b' S%d' % count if count else b'') + b'\n')
+    while True:
+        line = port.readline()
+        if not line:
+            sys.exit('No reply to M746')
+        if line.startswith(b'TEMP_HISTORY:'):
+            size = int(line[13:])
+            break
+    data = port.read(size)
+    if len(data) != size:
+        sys.exit('Frame cut short')
+    return data
+
+def dump(data, out):
+    if crc16(data[:-2]) != struct.unpack_from('<H', data, len(data) - 2)[0]:
+        sys.exit('Bad CRC')
+    version, channels, interval, samples, now = struct.unpack_from('<BBHHI', data)
+    pos = 10
+    chans = []
+    for _ in range(channels):
+        cid, heater = struct.unpack_from('<bB', data, pos)
+        pos += 2
+        chans.append((NAMES.get(cid, 'T%d' % cid), heater))
+    cols = []
+    for name, heater in chans:
+        cols += [name, name + '_low', name + '_high'] + ([name + '_power'] if heater else [])
+    print('# version=%d interval=%d now=%.3f' % (version, interval, now / 1000.0), file=out)
+    print('time,' + ','.join(cols), file=out)
+    for _ in range(samples):
+        ms, = struct.unpack_from('<I', data, pos)
+        pos += 4
+        row = ['%.3f' % (ms / 1000.0)]
+        for name, heater in chans:
+            mean, low, high, power = struct.unpack_from('<hhhB', data, pos)
+            pos += 7
+            row += ['%.1f' % (mean / 10.0), '%.1f' % (low / 10.0), '%.1f' % (high / 10.0)] + (['%d' % power] if heater else [])
+        print(','.join(row), file=out)
+
+def main():
+    ap = argparse.ArgumentParser(description='Fetch the temperature history from Marlin')
+    ap.add_argument('-b', '--baud', type=int, default=250000)
+    ap.add_argument('-n', '--count', type=int, default=0, help='Only the newest samples')
+    ap.add_argument('port')
+    args = ap.parse_args()
+    with serial.Serial(args.port, args.baud, timeout=5) as port:
+        dump(fetch(port, args.count), sys.stdout)
+
+if __name__ == '__main__':
+    main()